@@ -11,6 +11,7 @@ mkdir -p $PREFIX
 cp bin/libplugify-plugin-s2sdk.so $PREFIX/bin/
 cp gamedata.jsonc $PREFIX/
 cp settings.jsonc $PREFIX/
+cp event_rules.jsonc $PREFIX/
 cp plugify-plugin-s2sdk.pplugin $PREFIX/
 
 # Set proper permissions
@@ -13,6 +13,8 @@ static void CommandCallback(const CCommandContext&, const CCommand&) {
 }
 
 ConCommandInfo::ConCommandInfo(plg::string name, plg::string description) : name(std::move(name)), description(std::move(description)) {
+	callbacks[static_cast<size_t>(HookMode::Pre)].SetName("command:" + this->name + ":pre");
+	callbacks[static_cast<size_t>(HookMode::Post)].SetName("command:" + this->name + ":post");
 }
 
 ConCommandInfo::~ConCommandInfo() {
@@ -154,8 +156,9 @@ ResultType ConCommandManager::ExecuteCommandCallbacks(const plg::string& name, c
 
 	const auto& globalCallback = m_globalCallbacks[static_cast<size_t>(mode)];
 
-	for (size_t i = 0; i < globalCallback.GetCount(); ++i) {
-		auto thisResult = globalCallback.Notify(i, caller, callingContext, arguments);
+	const auto globalSnapshot = globalCallback.GetSnapshot();
+	for (const auto& listener : globalSnapshot) {
+		auto thisResult = globalSnapshot.Notify(listener, caller, callingContext, arguments);
 		if (thisResult >= ResultType::Stop) {
 			if (mode == HookMode::Pre) {
 				return ResultType::Stop;
@@ -180,8 +183,9 @@ ResultType ConCommandManager::ExecuteCommandCallbacks(const plg::string& name, c
 
 		const auto& callback = commandInfo.callbacks[static_cast<size_t>(mode)];
 
-		for (size_t i = 0; i < callback.GetCount(); ++i) {
-			auto thisResult = callback.Notify(i, caller, callingContext, arguments);
+		const auto snapshot = callback.GetSnapshot();
+		for (const auto& listener : snapshot) {
+			auto thisResult = snapshot.Notify(listener, caller, callingContext, arguments);
 			if (thisResult >= ResultType::Handled) {
 				return thisResult;
 			} else if (thisResult > result) {
@@ -47,7 +47,7 @@ public:
 private:
 	//std::vector<ConCommandInfo*> m_cmdList;
 	std::unordered_map<plg::string, CommandInfoPtr, plg::case_insensitive_hash, plg::case_insensitive_equal> m_cmdLookup;
-	std::array<ListenerManager<CommandListenerCallback>, 2> m_globalCallbacks;
+	std::array<ListenerManager<CommandListenerCallback>, 2> m_globalCallbacks{ListenerManager<CommandListenerCallback>("command:*:pre"), ListenerManager<CommandListenerCallback>("command:*:post")};
 	std::mutex m_registerCmdLock;
 };
 
@@ -12,6 +12,7 @@ ConVarManager::~ConVarManager() {
 }
 
 ConVarInfo::ConVarInfo(plg::string name, plg::string description) : name(std::move(name)), description(std::move(description)) {
+	hook.SetName("convar:" + this->name);
 }
 
 bool ConVarManager::RemoveConVar(const plg::string& name) {
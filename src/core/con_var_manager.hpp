@@ -159,6 +159,6 @@ public:
 private:
 	std::unordered_map<plg::string, ConVarInfoPtr, plg::case_insensitive_hash, plg::case_insensitive_equal> m_cnvLookup;
 	plg::flat_map<const ConVarRef*, const ConVarInfo*> m_cnvCache;
-	ListenerManager<ConVarChangeListenerCallback> m_global;
+	ListenerManager<ConVarChangeListenerCallback> m_global{"convar:*"};
 	std::mutex m_registerCnvLock;
 };
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include "coroutine_scheduler.hpp"
+#include "server_manager.hpp"
+#include "timer_system.hpp"
+
+void* CoroutineFrameAllocator::Allocate(size_t size) {
+	size_t bucket = (size - 1) / FRAME_GRANULARITY;
+	if (bucket >= FRAME_BUCKETS) {
+		return ::operator new(size);
+	}
+
+	auto& frames = s_freeFrames[bucket];
+	if (frames.empty()) {
+		return ::operator new((bucket + 1) * FRAME_GRANULARITY);
+	}
+
+	void* ptr = frames.back();
+	frames.pop_back();
+	return ptr;
+}
+
+void CoroutineFrameAllocator::Deallocate(void* ptr, size_t size) {
+	size_t bucket = (size - 1) / FRAME_GRANULARITY;
+	if (bucket >= FRAME_BUCKETS) {
+		::operator delete(ptr);
+		return;
+	}
+
+	s_freeFrames[bucket].push_back(ptr);
+}
+
+namespace {
+	// Tasks run on the main thread only, so a single slot carries the id without allocating
+	const plg::vector<plg::any>& MakeTaskData(uint32_t id) {
+		static plg::vector<plg::any> taskData(1);
+		taskData[0] = id;
+		return taskData;
+	}
+} // namespace
+
+uint32_t CoroutineScheduler::StartTask(CoroutineStepCallback callback, const plg::vector<plg::any>& userData) {
+	if (!IsMainThread()) {
+		S2_LOG(LS_WARNING, "Tasks can only be started from the main thread\n");
+		return 0;
+	}
+
+	uint32_t id = ++m_nextId;
+	m_tasks.emplace(id, ScriptTask{});
+	RunTask(id, callback, userData);
+	return id;
+}
+
+bool CoroutineScheduler::SetWait(uint32_t id, CoroutineWait wait, double amount) {
+	if (!IsMainThread()) {
+		S2_LOG(LS_WARNING, "Task waits can only be set from the main thread\n");
+		return false;
+	}
+
+	auto it = m_tasks.find(id);
+	if (it == m_tasks.end() || it->second.cancel) {
+		return false;
+	}
+
+	it->second.wait = wait;
+	it->second.amount = amount;
+	return true;
+}
+
+bool CoroutineScheduler::CancelTask(uint32_t id) {
+	if (!IsMainThread()) {
+		S2_LOG(LS_WARNING, "Tasks can only be cancelled from the main thread\n");
+		return false;
+	}
+
+	auto it = m_tasks.find(id);
+	if (it == m_tasks.end()) {
+		return false;
+	}
+
+	if (!it->second.handle) {
+		// Cancelled from its own step, the frame is live and finishes once the step returns
+		it->second.cancel = true;
+		return true;
+	}
+
+	ScriptTask task = it->second;
+	m_tasks.erase(it);
+	DestroyTask(task);
+	return true;
+}
+
+bool CoroutineScheduler::IsTaskRunning(uint32_t id) const {
+	if (!IsMainThread()) {
+		return false;
+	}
+
+	auto it = m_tasks.find(id);
+	return it != m_tasks.end() && !it->second.cancel;
+}
+
+void CoroutineScheduler::Clear() {
+	auto tasks = std::move(m_tasks);
+	m_tasks.clear();
+
+	for (auto& [id, task] : tasks) {
+		DestroyTask(task);
+	}
+}
+
+void CoroutineScheduler::DestroyTask(ScriptTask& task) {
+	if (task.timer != 0) {
+		g_TimerSystem.KillTimer(task.timer);
+	}
+
+	if (task.handle) {
+		task.handle.destroy();
+	}
+}
+
+void CoroutineScheduler::TaskAwaiter::await_suspend(std::coroutine_handle<> handle) const {
+	auto& task = scheduler->m_tasks[id];
+	task.handle = handle;
+	task.timer = 0;
+
+	const auto& resumeData = MakeTaskData(id);
+	switch (wait) {
+		case CoroutineWait::Seconds:
+			task.timer = g_TimerSystem.CreateTimer(amount, [](uint32_t, const plg::vector<plg::any>& userData) {
+				ResumeTask(userData);
+			}, Default, resumeData);
+			break;
+		case CoroutineWait::Ticks:
+			task.timer = g_TimerSystem.CreateTimer(amount, [](uint32_t, const plg::vector<plg::any>& userData) {
+				ResumeTask(userData);
+			}, Ticks, resumeData);
+			break;
+		case CoroutineWait::NextWorldUpdate:
+			g_ServerManager.AddTaskForNextWorldUpdate(&ResumeTask, resumeData);
+			break;
+		default:
+			g_ServerManager.AddTaskForNextFrame(&ResumeTask, resumeData);
+			break;
+	}
+}
+
+void CoroutineScheduler::ResumeTask(const plg::vector<plg::any>& userData) {
+	auto& tasks = g_CoroutineScheduler.m_tasks;
+	auto it = tasks.find(plg::get<uint32_t>(userData[0]));
+	if (it == tasks.end() || !it->second.handle) {
+		return;
+	}
+
+	auto handle = it->second.handle;
+	it->second.handle = {};
+	it->second.timer = 0;
+	handle.resume();
+}
+
+bool CoroutineScheduler::IsMainThread() const {
+	return std::this_thread::get_id() == m_mainThreadId;
+}
+
+CoroutineTask CoroutineScheduler::RunTask(uint32_t id, CoroutineStepCallback callback, plg::vector<plg::any> userData) {
+	co_await TaskAwaiter{this, id, CoroutineWait::NextFrame, 0.0};
+
+	for (uint32_t step = 0;; ++step) {
+		auto it = m_tasks.find(id);
+		if (it == m_tasks.end() || it->second.cancel) {
+			break;
+		}
+
+		it->second.wait = CoroutineWait::None;
+
+		callback(id, step, userData);
+
+		// The callback may start other tasks, so the iterator is not reused
+		it = m_tasks.find(id);
+		if (it == m_tasks.end() || it->second.cancel || it->second.wait == CoroutineWait::None) {
+			break;
+		}
+
+		co_await TaskAwaiter{this, id, it->second.wait, it->second.amount};
+	}
+
+	m_tasks.erase(id);
+}
+
+CoroutineScheduler g_CoroutineScheduler;
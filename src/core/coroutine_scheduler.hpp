@@ -0,0 +1,88 @@
+#pragma once
+
+#include <coroutine>
+#include <thread>
+
+// Size bucketed free lists for coroutine frames, main thread only.
+// Frames up to FRAME_BUCKETS * FRAME_GRANULARITY bytes are recycled, bigger ones go to the heap.
+class CoroutineFrameAllocator {
+public:
+	static constexpr size_t FRAME_GRANULARITY = 64;
+	static constexpr size_t FRAME_BUCKETS = 16;
+
+	static void* Allocate(size_t size);
+	static void Deallocate(void* ptr, size_t size);
+
+private:
+	static inline std::array<std::vector<void*>, FRAME_BUCKETS> s_freeFrames;
+};
+
+// Fire-and-forget coroutine, starts eagerly and frees its frame when it finishes.
+struct CoroutineTask {
+	struct promise_type {
+		CoroutineTask get_return_object() noexcept { return {}; }
+		std::suspend_never initial_suspend() noexcept { return {}; }
+		std::suspend_never final_suspend() noexcept { return {}; }
+		void return_void() noexcept {}
+		void unhandled_exception() noexcept { std::terminate(); }
+
+		static void* operator new(size_t size) { return CoroutineFrameAllocator::Allocate(size); }
+		static void operator delete(void* ptr, size_t size) { CoroutineFrameAllocator::Deallocate(ptr, size); }
+	};
+};
+
+enum class CoroutineWait : int {
+	None,
+	Seconds,
+	Ticks,
+	NextFrame,
+	NextWorldUpdate,
+};
+
+using CoroutineStepCallback = void (*)(uint32_t, uint32_t, const plg::vector<plg::any>&);
+
+// Drives resumable tasks for plugins that cannot write C++ coroutines.
+// Every step calls back into the plugin, which picks the next wait with SetWait;
+// a step that picks nothing finishes the task. Main thread only.
+class CoroutineScheduler {
+public:
+	uint32_t StartTask(CoroutineStepCallback callback, const plg::vector<plg::any>& userData);
+	bool SetWait(uint32_t id, CoroutineWait wait, double amount = 0.0);
+	bool CancelTask(uint32_t id);
+	bool IsTaskRunning(uint32_t id) const;
+	void Clear();
+
+private:
+	struct ScriptTask {
+		CoroutineWait wait{};
+		double amount{};
+		bool cancel{};
+		std::coroutine_handle<> handle; // set while the task waits, empty while its step runs
+		uint32_t timer{};               // timer that resumes the task, if the wait uses one
+	};
+
+	// Parks the task until its wait fires. Resuming looks the task up by id,
+	// so a wait that fires after the task was destroyed does nothing.
+	struct TaskAwaiter {
+		CoroutineScheduler* scheduler;
+		uint32_t id;
+		CoroutineWait wait;
+		double amount;
+
+		bool await_ready() const noexcept { return false; }
+		void await_suspend(std::coroutine_handle<> handle) const;
+		void await_resume() const noexcept {}
+	};
+
+	CoroutineTask RunTask(uint32_t id, CoroutineStepCallback callback, plg::vector<plg::any> userData);
+	void DestroyTask(ScriptTask& task);
+	static void ResumeTask(const plg::vector<plg::any>& userData);
+	bool IsMainThread() const;
+
+private:
+	std::unordered_map<uint32_t, ScriptTask> m_tasks;
+	uint32_t m_nextId{};
+	std::thread::id m_mainThreadId{std::this_thread::get_id()};
+};
+
+extern CoroutineScheduler g_CoroutineScheduler;
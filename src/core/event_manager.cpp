@@ -1,4 +1,12 @@
 #include "event_manager.hpp"
+#include "event_recorder.hpp"
+#include "player_manager.hpp"
+#include <core/sdk/utils.h>
+#include <convar.h>
+#include <entity2/entitysystem.h>
+#include <plugify-configs/plugify-configs.hpp>
+
+EventManager::EventManager() = default;
 
 EventManager::~EventManager() {
 	while (!m_freeEvents.empty()) {
@@ -14,52 +22,30 @@ EventManager::~EventManager() {
 EventHookError EventManager::HookEvent(const plg::string& name, EventListenerCallback callback, HookMode mode) {
 	std::unique_lock<std::mutex> lock(m_registerEventLock);
 
-	if (!g_pGameEventManager->FindListener(this, name.c_str())) {
-		if (!g_pGameEventManager->AddListener(this, name.c_str(), true)) {
-			return EventHookError::InvalidEvent;
-		}
+	EventHook* eventHook = FindOrCreateEventHook(name);
+	if (eventHook == nullptr) {
+		return EventHookError::InvalidEvent;
 	}
 
-	auto it = m_eventHooks.find(name);
-	if (it == m_eventHooks.end()) {
-		EventHook eventHook{name};
-
-		if (mode == HookMode::Pre) {
-			eventHook.preHook = std::make_unique<HookCallback>();
-			eventHook.preHook->Register(callback);
-		} else {
-			eventHook.postHook = std::make_unique<HookCallback>();
-			eventHook.postHook->Register(callback);
-			eventHook.postCopy = (mode == HookMode::Post);
-		}
-
-		++eventHook.refCount;
-
-		m_eventHooks.emplace(name, std::move(eventHook));
-
-		return EventHookError::Okay;
-	}
-
-	auto& eventHook = std::get<EventHook>(*it);
 	if (mode == HookMode::Pre) {
-		if (eventHook.preHook == nullptr) {
-			eventHook.preHook = std::make_unique<HookCallback>();
+		if (eventHook->preHook == nullptr) {
+			eventHook->preHook = std::make_unique<HookCallback>("event:" + name + ":pre");
 		}
 
-		eventHook.preHook->Register(callback);
+		eventHook->preHook->Register(callback);
 	} else {
-		if (eventHook.postHook == nullptr) {
-			eventHook.postHook = std::make_unique<HookCallback>();
+		if (eventHook->postHook == nullptr) {
+			eventHook->postHook = std::make_unique<HookCallback>("event:" + name + ":post");
 		}
 
-		if (!eventHook.postCopy) {
-			eventHook.postCopy = (mode == HookMode::Post);
+		if (!eventHook->postCopy) {
+			eventHook->postCopy = (mode == HookMode::Post);
 		}
 
-		eventHook.postHook->Register(callback);
+		eventHook->postHook->Register(callback);
 	}
 
-	++eventHook.refCount;
+	++eventHook->refCount;
 
 	return EventHookError::Okay;
 }
@@ -84,11 +70,494 @@ EventHookError EventManager::UnhookEvent(const plg::string& name, EventListenerC
 		return EventHookError::InvalidCallback;
 	}
 
+	ReleaseEventHook(eventHook);
+
+	return EventHookError::Okay;
+}
+
+EventHook* EventManager::FindOrCreateEventHook(const plg::string& name) {
+	if (!g_pGameEventManager->FindListener(this, name.c_str())) {
+		if (!g_pGameEventManager->AddListener(this, name.c_str(), true)) {
+			return nullptr;
+		}
+	}
+
+	auto [it, inserted] = m_eventHooks.try_emplace(name, EventHook{name});
+	auto& eventHook = std::get<EventHook>(*it);
+	if (inserted) {
+		IndexEventHook(eventHook);
+	}
+
+	return &eventHook;
+}
+
+void EventManager::ReleaseEventHook(EventHook& eventHook) {
 	if (--eventHook.refCount == 0) {
-		m_eventHooks.erase(it);
+		RemoveEventHook(eventHook);
 	}
+}
 
-	return EventHookError::Okay;
+void EventManager::RemoveEventHook(EventHook& eventHook) {
+	UnindexEventHook(eventHook);
+	m_eventHooks.erase(m_eventHooks.find(eventHook.name));
+}
+
+void EventManager::IndexEventHook(EventHook& eventHook) {
+	// Ids come from the descriptor table, a throwaway event is the only public way to read them
+	IGameEvent* event = g_pGameEventManager->CreateEvent(eventHook.name.c_str(), true);
+	if (!event) {
+		eventHook.id = -1;
+		return;
+	}
+
+	eventHook.id = event->GetID();
+	g_pGameEventManager->FreeEvent(event);
+
+	if (eventHook.id < 0) {
+		return;
+	}
+
+	size_t index = static_cast<size_t>(eventHook.id);
+	if (index >= m_eventIndex.size()) {
+		m_eventIndex.resize(index + 1);
+	}
+
+	m_eventIndex[index] = &eventHook;
+}
+
+void EventManager::UnindexEventHook(const EventHook& eventHook) {
+	size_t index = static_cast<size_t>(eventHook.id);
+	if (index < m_eventIndex.size() && m_eventIndex[index] == &eventHook) {
+		m_eventIndex[index] = nullptr;
+	}
+}
+
+uint32_t EventManager::CreateEventStream(const plg::string& name, const plg::vector<plg::string>& keys, const plg::vector<EventFieldType>& types, uint32_t capacity, EventStreamCallback callback, const plg::vector<plg::any>& userData) {
+	if (keys.size() != types.size() || capacity == 0 || callback == nullptr) {
+		return 0;
+	}
+
+	auto handles = ResolveEventKeys(name, keys);
+	if (handles.size() != keys.size()) {
+		return 0;
+	}
+
+	std::unique_lock<std::mutex> lock(m_registerEventLock);
+
+	EventHook* eventHook = FindOrCreateEventHook(name);
+	if (eventHook == nullptr) {
+		return 0;
+	}
+
+	auto& stream = m_eventStreams.emplace_back(std::make_unique<EventStream>());
+	stream->id = ++m_nextStreamId;
+	stream->hook = eventHook;
+	stream->fields = {name, std::move(handles), types};
+	stream->callback = callback;
+	stream->userData = userData;
+	stream->ring.resize(static_cast<size_t>(capacity) * keys.size());
+	stream->capacity = capacity;
+
+	eventHook->streams.push_back(stream.get());
+	++eventHook->refCount;
+
+	return stream->id;
+}
+
+bool EventManager::DestroyEventStream(uint32_t id) {
+	std::unique_lock<std::mutex> lock(m_registerEventLock);
+
+	auto it = std::find_if(m_eventStreams.begin(), m_eventStreams.end(), [id](const auto& stream) {
+		return stream->id == id && !stream->removed;
+	});
+	if (it == m_eventStreams.end()) {
+		return false;
+	}
+
+	auto& stream = **it;
+	auto& streams = stream.hook->streams;
+	streams.erase(std::find(streams.begin(), streams.end(), &stream));
+	ReleaseEventHook(*stream.hook);
+	stream.hook = nullptr;
+
+	// A batch callback may destroy streams, erasing is left to the flush then
+	if (m_flushingStreams) {
+		stream.removed = true;
+	} else {
+		m_eventStreams.erase(it);
+	}
+
+	return true;
+}
+
+uint64_t EventManager::GetEventStreamDropCount(uint32_t id) const {
+	auto it = std::find_if(m_eventStreams.begin(), m_eventStreams.end(), [id](const auto& stream) {
+		return stream->id == id && !stream->removed;
+	});
+	return it != m_eventStreams.end() ? (*it)->dropped : 0;
+}
+
+void EventManager::CaptureEvent(IGameEvent* event, EventStream& stream) {
+	uint32_t slot;
+	if (stream.count < stream.capacity) {
+		slot = (stream.head + stream.count++) % stream.capacity;
+	} else {
+		slot = stream.head;
+		stream.head = (stream.head + 1) % stream.capacity;
+		++stream.dropped;
+	}
+
+	ReadEventFields(event, stream.fields, stream.ring.data() + static_cast<size_t>(slot) * stream.fields.keys.size());
+}
+
+void EventManager::FlushEventStreams() {
+	m_flushingStreams = true;
+
+	// Streams created by a callback are appended and only delivered on the next flush
+	for (size_t i = 0, size = m_eventStreams.size(); i < size; ++i) {
+		auto& stream = *m_eventStreams[i];
+		if (stream.removed || stream.count == 0) {
+			continue;
+		}
+
+		size_t fieldCount = stream.fields.keys.size();
+		m_streamBatch.clear();
+		m_streamBatch.reserve(stream.count * fieldCount);
+		for (uint32_t j = 0; j < stream.count; ++j) {
+			auto record = stream.ring.begin() + static_cast<ptrdiff_t>(((stream.head + j) % stream.capacity) * fieldCount);
+			std::move(record, record + static_cast<ptrdiff_t>(fieldCount), std::back_inserter(m_streamBatch));
+		}
+
+		uint32_t count = stream.count;
+		stream.head = 0;
+		stream.count = 0;
+
+		stream.callback(stream.id, count, m_streamBatch, stream.userData);
+	}
+
+	m_flushingStreams = false;
+
+	std::erase_if(m_eventStreams, [](const auto& stream) {
+		return stream->removed;
+	});
+}
+
+namespace {
+	std::optional<EventFieldType> ParseEventFieldType(std::string_view type) {
+		if (type == "bool") return EventFieldType::Bool;
+		if (type == "float") return EventFieldType::Float;
+		if (type == "int") return EventFieldType::Int;
+		if (type == "uint64") return EventFieldType::UInt64;
+		if (type == "string") return EventFieldType::String;
+		if (type == "player") return EventFieldType::PlayerIndex;
+		if (type == "entity") return EventFieldType::EntityIndex;
+		return std::nullopt;
+	}
+
+	std::optional<EventRuleOp> ParseEventRuleOp(std::string_view op) {
+		if (op == "==") return EventRuleOp::Equal;
+		if (op == "!=") return EventRuleOp::NotEqual;
+		if (op == "<") return EventRuleOp::Less;
+		if (op == "<=") return EventRuleOp::LessEqual;
+		if (op == ">") return EventRuleOp::Greater;
+		if (op == ">=") return EventRuleOp::GreaterEqual;
+		return std::nullopt;
+	}
+
+	std::optional<EventRuleAction> ParseEventRuleAction(std::string_view action) {
+		if (action == "block") return EventRuleAction::Block;
+		if (action == "dontbroadcast") return EventRuleAction::DontBroadcast;
+		if (action == "set") return EventRuleAction::Set;
+		return std::nullopt;
+	}
+
+	// Floats and 64-bit values are written as strings, json numbers cannot hold every uint64
+	std::optional<plg::any> ParseEventRuleValue(std::unique_ptr<pcf::Config>& config, EventFieldType type) {
+		// A missing value is an error, it would otherwise read as false or 0
+		if (!config->JumpKey("value")) {
+			return std::nullopt;
+		}
+		config->JumpBack();
+
+		switch (type) {
+			case EventFieldType::Bool:
+				return plg::any(config->GetBool("value", false));
+			case EventFieldType::Int:
+			case EventFieldType::PlayerIndex:
+			case EventFieldType::EntityIndex:
+				return plg::any(config->GetAsInt32("value", 0));
+			case EventFieldType::Float: {
+				plg::string text = config->GetString("value");
+				float value;
+				auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+				if (ec != std::errc()) {
+					return std::nullopt;
+				}
+				return plg::any(value);
+			}
+			case EventFieldType::UInt64: {
+				auto value = utils::string_to_int<uint64_t>(config->GetString("value"));
+				if (!value) {
+					return std::nullopt;
+				}
+				return plg::any(*value);
+			}
+			case EventFieldType::String:
+				return plg::any(config->GetString("value"));
+			default:
+				return std::nullopt;
+		}
+	}
+
+	template<typename T>
+	bool CompareEventRuleValue(const T& lhs, const T& rhs, EventRuleOp op) {
+		switch (op) {
+			case EventRuleOp::Equal: return lhs == rhs;
+			case EventRuleOp::NotEqual: return lhs != rhs;
+			case EventRuleOp::Less: return lhs < rhs;
+			case EventRuleOp::LessEqual: return lhs <= rhs;
+			case EventRuleOp::Greater: return lhs > rhs;
+			case EventRuleOp::GreaterEqual: return lhs >= rhs;
+			default: return false;
+		}
+	}
+} // namespace
+
+bool EventManager::MatchEventRule(IGameEvent* event, const EventRule& rule) {
+	for (const auto& condition : rule.conditions) {
+		const auto& key = condition.key->symbol;
+		bool match;
+		switch (condition.type) {
+			case EventFieldType::Bool:
+				match = CompareEventRuleValue(event->GetBool(key), plg::get<bool>(condition.value), condition.op);
+				break;
+			case EventFieldType::Int:
+				match = CompareEventRuleValue(event->GetInt(key), plg::get<int>(condition.value), condition.op);
+				break;
+			case EventFieldType::PlayerIndex:
+				match = CompareEventRuleValue(event->GetPlayerSlot(key).Get(), plg::get<int>(condition.value), condition.op);
+				break;
+			case EventFieldType::EntityIndex:
+				match = CompareEventRuleValue(event->GetEntityIndex(key).Get(), plg::get<int>(condition.value), condition.op);
+				break;
+			case EventFieldType::Float:
+				match = CompareEventRuleValue(event->GetFloat(key), plg::get<float>(condition.value), condition.op);
+				break;
+			case EventFieldType::UInt64:
+				match = CompareEventRuleValue(static_cast<uint64_t>(event->GetUint64(key)), plg::get<uint64_t>(condition.value), condition.op);
+				break;
+			case EventFieldType::String:
+				match = CompareEventRuleValue(std::string_view(event->GetString(key)), std::string_view(plg::get<plg::string>(condition.value)), condition.op);
+				break;
+			default:
+				match = false;
+				break;
+		}
+
+		if (!match) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool EventManager::LoadEventRules(plg::vector<plg::string> paths) {
+	m_eventRulesPaths = std::move(paths);
+	return ReloadEventRules();
+}
+
+bool EventManager::ReloadEventRules() {
+	std::vector<std::string_view> paths;
+	paths.reserve(m_eventRulesPaths.size());
+	for (const auto& path : m_eventRulesPaths) {
+		paths.emplace_back(path);
+	}
+	auto config = pcf::ReadConfigs(paths);
+	if (!config) {
+		S2_LOGF(LS_ERROR, "Failed to load configuration file: \"{}\"\n", pcf::GetError());
+		return false;
+	}
+
+	std::unique_lock<std::mutex> lock(m_registerEventLock);
+
+	// The new set is built completely before any hook sees it, a broken rule is skipped rather than half applied
+	auto eventRules = std::make_unique<std::unordered_map<plg::string, std::vector<EventRule>>>();
+
+	if (config->JumpKey("EventRules")) {
+		if (config->IsArray() && config->JumpFirst()) {
+			do {
+				if (!config->IsObject()) {
+					continue;
+				}
+
+				plg::string name = config->GetString("event");
+				EventRule rule;
+				bool valid = true;
+
+				auto action = ParseEventRuleAction(config->GetString("action"));
+				if (!action) {
+					S2_LOGF(LS_WARNING, "Event rule for \"{}\" has an unknown action\n", name);
+					continue;
+				}
+				rule.action = *action;
+				rule.setFields.name = name;
+
+				if (config->JumpKey("conditions")) {
+					if (config->IsArray() && config->JumpFirst()) {
+						do {
+							auto type = ParseEventFieldType(config->GetString("type"));
+							auto op = ParseEventRuleOp(config->GetString("op", "=="));
+							auto value = type ? ParseEventRuleValue(config, *type) : std::nullopt;
+							if (!type || !op || !value) {
+								valid = false;
+								continue;
+							}
+							rule.conditions.emplace_back(InternEventKey(config->GetString("key")), *type, *op, std::move(*value));
+						} while (config->JumpNext());
+						config->JumpBack();
+					}
+					config->JumpBack();
+				}
+
+				if (config->JumpKey("set")) {
+					if (config->IsArray() && config->JumpFirst()) {
+						do {
+							auto type = ParseEventFieldType(config->GetString("type"));
+							auto value = type ? ParseEventRuleValue(config, *type) : std::nullopt;
+							if (!type || !value) {
+								valid = false;
+								continue;
+							}
+							rule.setFields.keys.push_back(InternEventKey(config->GetString("key")));
+							rule.setFields.types.push_back(*type);
+							rule.setValues.push_back(std::move(*value));
+						} while (config->JumpNext());
+						config->JumpBack();
+					}
+					config->JumpBack();
+				}
+
+				if (!valid) {
+					S2_LOGF(LS_WARNING, "Event rule for \"{}\" has an invalid condition or field\n", name);
+					continue;
+				}
+
+				(*eventRules)[name].push_back(std::move(rule));
+			} while (config->JumpNext());
+			config->JumpBack();
+		}
+		config->JumpBack();
+	}
+
+	// Hooks of the new set are taken before the old ones are released, so events kept by both stay indexed.
+	// Unknown events are dropped, the next reload releases a hook for every name left in the set.
+	for (auto it = eventRules->begin(); it != eventRules->end();) {
+		EventHook* eventHook = FindOrCreateEventHook(it->first);
+		if (eventHook == nullptr) {
+			S2_LOGF(LS_WARNING, "Event rules reference unknown event \"{}\"\n", it->first);
+			it = eventRules->erase(it);
+			continue;
+		}
+
+		eventHook->rules = &it->second;
+		++eventHook->refCount;
+		++it;
+	}
+
+	if (m_eventRules != nullptr) {
+		for (auto& [name, rules] : *m_eventRules) {
+			auto it = m_eventHooks.find(name);
+			if (it == m_eventHooks.end()) {
+				continue;
+			}
+
+			auto& eventHook = std::get<EventHook>(*it);
+			if (eventHook.rules == &rules) {
+				eventHook.rules = nullptr;
+			}
+			ReleaseEventHook(eventHook);
+		}
+	}
+
+	S2_LOGF(LS_MESSAGE, "Loaded event rules for {} events\n", eventRules->size());
+
+	m_eventRules = std::move(eventRules);
+
+	return true;
+}
+
+bool EventManager::StartEventRecording(const plg::string& path, plg::vector<EventTemplate> templates) {
+	std::unique_lock<std::mutex> lock(m_registerEventLock);
+
+	if (m_eventRecorder != nullptr) {
+		return false;
+	}
+
+	// A hook has a single record slot, a second template for the same event would take it over
+	std::unordered_set<std::string_view> names;
+	for (const auto& eventTemplate : templates) {
+		if (!names.emplace(eventTemplate.name).second) {
+			S2_LOGF(LS_WARNING, "Event \"{}\" is listed more than once for recording\n", eventTemplate.name);
+			return false;
+		}
+	}
+
+	m_eventRecorder = EventRecorder::Open(path, std::move(templates));
+	if (m_eventRecorder == nullptr) {
+		return false;
+	}
+
+	const auto& recorded = m_eventRecorder->GetTemplates();
+	for (size_t i = 0; i < recorded.size(); ++i) {
+		EventHook* eventHook = FindOrCreateEventHook(recorded[i].name);
+		if (eventHook == nullptr) {
+			S2_LOGF(LS_WARNING, "Cannot record unknown event \"{}\"\n", recorded[i].name);
+			continue;
+		}
+
+		eventHook->recordIndex = static_cast<int>(i);
+		++eventHook->refCount;
+	}
+
+	return true;
+}
+
+bool EventManager::StopEventRecording() {
+	std::unique_lock<std::mutex> lock(m_registerEventLock);
+
+	if (m_eventRecorder == nullptr) {
+		return false;
+	}
+
+	const auto& recorded = m_eventRecorder->GetTemplates();
+	for (size_t i = 0; i < recorded.size(); ++i) {
+		auto it = m_eventHooks.find(recorded[i].name);
+		if (it == m_eventHooks.end() || std::get<EventHook>(*it).recordIndex != static_cast<int>(i)) {
+			continue;
+		}
+
+		auto& eventHook = std::get<EventHook>(*it);
+		eventHook.recordIndex = -1;
+		ReleaseEventHook(eventHook);
+	}
+
+	S2_LOGF(LS_MESSAGE, "Recorded {} events\n", m_eventRecorder->GetCount());
+
+	m_eventRecorder.reset();
+
+	return true;
+}
+
+void EventManager::RebuildEventIndex() {
+	std::unique_lock<std::mutex> lock(m_registerEventLock);
+
+	// Descriptors are reloaded with the server, ids from the previous load may point elsewhere
+	m_eventIndex.clear();
+
+	for (auto& [_, eventHook] : m_eventHooks) {
+		IndexEventHook(eventHook);
+	}
 }
 
 void EventManager::FireGameEvent(IGameEvent* event) {
@@ -133,41 +602,260 @@ void EventManager::CancelCreatedEvent(EventInfo* info) {
 	m_freeEvents.push(info);
 }
 
+plg::vector<EventKey*> EventManager::ResolveEventKeys(const plg::string& name, const plg::vector<plg::string>& keys) {
+	IGameEvent* event = g_pGameEventManager->CreateEvent(name.c_str(), true);
+	if (!event) {
+		return {};
+	}
+
+	g_pGameEventManager->FreeEvent(event);
+
+	std::unique_lock<std::mutex> lock(m_registerEventLock);
+
+	plg::vector<EventKey*> handles;
+	handles.reserve(keys.size());
+	for (const auto& key : keys) {
+		handles.push_back(InternEventKey(key));
+	}
+
+	return handles;
+}
+
+EventKey* EventManager::InternEventKey(const plg::string& key) {
+	// Symbols do not depend on the event, so keys shared by several events resolve to the same handle
+	auto& eventKey = m_eventKeys[key];
+	if (eventKey == nullptr) {
+		eventKey = std::make_unique<EventKey>(key);
+	}
+	return eventKey.get();
+}
+
+EventTemplate* EventManager::CreateEventTemplate(const plg::string& name, const plg::vector<plg::string>& keys, const plg::vector<EventFieldType>& types) {
+	if (keys.size() != types.size()) {
+		return nullptr;
+	}
+
+	auto handles = ResolveEventKeys(name, keys);
+	if (handles.size() != keys.size()) {
+		return nullptr;
+	}
+
+	std::unique_lock<std::mutex> lock(m_registerEventLock);
+
+	return m_eventTemplates.emplace_back(std::make_unique<EventTemplate>(name, std::move(handles), types)).get();
+}
+
+bool EventManager::DestroyEventTemplate(EventTemplate* eventTemplate) {
+	std::unique_lock<std::mutex> lock(m_registerEventLock);
+
+	auto it = std::find_if(m_eventTemplates.begin(), m_eventTemplates.end(), [eventTemplate](const auto& other) {
+		return other.get() == eventTemplate;
+	});
+	if (it == m_eventTemplates.end()) {
+		return false;
+	}
+
+	m_eventTemplates.erase(it);
+	return true;
+}
+
+EventInfo* EventManager::CreateEvent(const EventTemplate& eventTemplate, const plg::vector<plg::any>& values, bool force) {
+	EventInfo* info = CreateEvent(eventTemplate.name, force);
+	if (info) {
+		WriteEventFields(info->event, eventTemplate, values);
+	}
+
+	return info;
+}
+
+plg::vector<plg::any> EventManager::ReadEventFields(IGameEvent* event, const EventTemplate& eventTemplate) {
+	plg::vector<plg::any> values(eventTemplate.keys.size());
+	ReadEventFields(event, eventTemplate, values.data());
+	return values;
+}
+
+void EventManager::ReadEventFields(IGameEvent* event, const EventTemplate& eventTemplate, plg::any* values) {
+	for (size_t i = 0; i < eventTemplate.keys.size(); ++i) {
+		const auto& key = eventTemplate.keys[i]->symbol;
+		switch (eventTemplate.types[i]) {
+			case EventFieldType::Bool:
+				values[i] = event->GetBool(key);
+				break;
+			case EventFieldType::Float:
+				values[i] = event->GetFloat(key);
+				break;
+			case EventFieldType::Int:
+				values[i] = event->GetInt(key);
+				break;
+			case EventFieldType::UInt64:
+				values[i] = static_cast<uint64_t>(event->GetUint64(key));
+				break;
+			case EventFieldType::String:
+				values[i] = plg::string(event->GetString(key));
+				break;
+			case EventFieldType::Ptr:
+				values[i] = event->GetPtr(key);
+				break;
+			case EventFieldType::PlayerIndex:
+				values[i] = event->GetPlayerSlot(key).Get();
+				break;
+			case EventFieldType::EntityIndex:
+				values[i] = event->GetEntityIndex(key).Get();
+				break;
+			case EventFieldType::EntityHandle:
+				values[i] = event->GetEHandle(key).ToInt();
+				break;
+			default:
+				values[i] = {};
+				break;
+		}
+	}
+}
+
+void EventManager::WriteEventFields(IGameEvent* event, const EventTemplate& eventTemplate, const plg::vector<plg::any>& values) {
+	size_t count = std::min(eventTemplate.keys.size(), values.size());
+
+	for (size_t i = 0; i < count; ++i) {
+		const auto& key = eventTemplate.keys[i]->symbol;
+		const auto& value = values[i];
+		switch (eventTemplate.types[i]) {
+			case EventFieldType::Bool:
+				plg::visit([&](const auto& v) {
+					using T = std::decay_t<decltype(v)>;
+					if constexpr (std::is_arithmetic_v<T>) event->SetBool(key, static_cast<bool>(v));
+				}, value);
+				break;
+			case EventFieldType::Float:
+				plg::visit([&](const auto& v) {
+					using T = std::decay_t<decltype(v)>;
+					if constexpr (std::is_arithmetic_v<T>) event->SetFloat(key, static_cast<float>(v));
+				}, value);
+				break;
+			case EventFieldType::Int:
+				plg::visit([&](const auto& v) {
+					using T = std::decay_t<decltype(v)>;
+					if constexpr (std::is_arithmetic_v<T>) event->SetInt(key, static_cast<int>(v));
+				}, value);
+				break;
+			case EventFieldType::UInt64:
+				plg::visit([&](const auto& v) {
+					using T = std::decay_t<decltype(v)>;
+					if constexpr (std::is_arithmetic_v<T>) event->SetUint64(key, static_cast<uint64>(v));
+				}, value);
+				break;
+			case EventFieldType::String:
+				plg::visit([&](const auto& v) {
+					using T = std::decay_t<decltype(v)>;
+					if constexpr (std::is_same_v<T, plg::string>) event->SetString(key, v.c_str());
+				}, value);
+				break;
+			case EventFieldType::Ptr:
+				plg::visit([&](const auto& v) {
+					using T = std::decay_t<decltype(v)>;
+					if constexpr (std::is_same_v<T, void*>) event->SetPtr(key, v);
+				}, value);
+				break;
+			case EventFieldType::PlayerIndex:
+				plg::visit([&](const auto& v) {
+					using T = std::decay_t<decltype(v)>;
+					if constexpr (std::is_arithmetic_v<T>) event->SetPlayer(key, CPlayerSlot(static_cast<int>(v)));
+				}, value);
+				break;
+			case EventFieldType::EntityIndex:
+				plg::visit([&](const auto& v) {
+					using T = std::decay_t<decltype(v)>;
+					if constexpr (std::is_arithmetic_v<T>) event->SetEntity(key, CEntityIndex(static_cast<int>(v)));
+				}, value);
+				break;
+			case EventFieldType::EntityHandle:
+				plg::visit([&](const auto& v) {
+					using T = std::decay_t<decltype(v)>;
+					if constexpr (std::is_arithmetic_v<T>) event->SetEntity(key, CEntityHandle(static_cast<uint32>(v)).Get());
+				}, value);
+				break;
+			default:
+				break;
+		}
+	}
+}
+
 ResultType EventManager::OnFireEvent(IGameEvent* event, const bool dontBroadcast) {
 	if (!event)
 		return ResultType::Continue;
 
-	plg::string name(event->GetName());
+	size_t index = static_cast<size_t>(event->GetID());
+	EventHook* hook = index < m_eventIndex.size() ? m_eventIndex[index] : nullptr;
 	bool localDontBroadcast = dontBroadcast;
 
-	auto it = m_eventHooks.find(name);
-	if (it != m_eventHooks.end()) {
-		auto& eventHook = std::get<EventHook>(*it);
+	if (hook != nullptr) {
+		auto& eventHook = *hook;
 		++eventHook.refCount;
-		m_eventStack.push(&eventHook);
+		m_eventStack.push({&eventHook});
+
+		if (eventHook.recordIndex >= 0 && m_eventRecorder != nullptr) {
+			m_eventRecorder->Write(event, static_cast<uint32_t>(eventHook.recordIndex), dontBroadcast, gpGlobals ? gpGlobals->tickcount : 0);
+		}
+
+		// The engine frees the event before post hooks run, so a copy is only kept when someone will read it
+		bool postCopy = eventHook.postCopy && !eventHook.postHook->Empty();
+
+		// A superseded event is never freed by the engine, post hooks get the original instead of a copy
+		auto supersede = [&]() {
+			if (postCopy) {
+				m_eventStack.top().event = event;
+				++m_avoidedDuplicateCount;
+			} else {
+				g_pGameEventManager->FreeEvent(event);
+			}
+			return ResultType::Handled;
+		};
+
+		if (eventHook.rules != nullptr) {
+			for (const auto& rule : *eventHook.rules) {
+				if (!MatchEventRule(event, rule)) {
+					continue;
+				}
+
+				switch (rule.action) {
+					case EventRuleAction::Block:
+						return supersede();
+					case EventRuleAction::DontBroadcast:
+						localDontBroadcast = true;
+						break;
+					case EventRuleAction::Set:
+						WriteEventFields(event, rule.setFields, rule.setValues);
+						break;
+				}
+			}
+		}
 
 		if (eventHook.preHook != nullptr) {
 			//S2_LOGF(LS_DEBUG, "Pushing event `{}` pointer: {}, dont broadcast: {}, post: {}\n", pEvent->GetName(), pEvent, bDontBroadcast, false);
 
-			EventInfo eventInfo{event, dontBroadcast};
+			EventInfo eventInfo{event, localDontBroadcast};
 
-			for (size_t i = 0; i < eventHook.preHook->GetCount(); ++i) {
-				auto result = eventHook.preHook->Notify(i, name, &eventInfo, dontBroadcast);
+			const auto snapshot = eventHook.preHook->GetSnapshot();
+			for (const auto& listener : snapshot) {
+				auto result = snapshot.Notify(listener, eventHook.name, &eventInfo, localDontBroadcast);
 				localDontBroadcast = eventInfo.dontBroadcast;
 
 				if (result >= ResultType::Handled) {
-					// m_EventCopies.push(g_gameEventManager->DuplicateEvent(pEvent));
-					g_pGameEventManager->FreeEvent(event);
-					return ResultType::Handled;
+					return supersede();
 				}
 			}
 		}
 
-		if (eventHook.postCopy) {
-			m_eventCopies.push(g_pGameEventManager->DuplicateEvent(event));
+		for (auto* stream : eventHook.streams) {
+			CaptureEvent(event, *stream);
+		}
+
+		if (postCopy) {
+			m_eventStack.top().event = g_pGameEventManager->DuplicateEvent(event);
+		} else if (eventHook.postCopy) {
+			++m_avoidedDuplicateCount;
 		}
 	} else {
-		m_eventStack.push(nullptr);
+		m_eventStack.push({});
 	}
 
 	if (localDontBroadcast != dontBroadcast) {
@@ -181,36 +869,114 @@ ResultType EventManager::OnFireEvent_Post(IGameEvent* event, bool dontBroadcast)
 	if (!event)
 		return ResultType::Continue;
 
-	EventHook* hook = m_eventStack.top();
+	auto [hook, eventCopy] = m_eventStack.top();
+	m_eventStack.pop();
 
 	if (hook != nullptr) {
-		if (hook->postHook != nullptr) {
-			if (hook->postCopy) {
-				auto eventCopy = m_eventCopies.top();
-				//S2_LOGF(LS_DEBUG, "Pushing event `{}` pointer: {}, dont broadcast: {}, post: {}\n", eventCopy->GetName(), eventCopy, bDontBroadcast, true);
-				EventInfo eventInfo{eventCopy, dontBroadcast};
+		if (eventCopy != nullptr) {
+			//S2_LOGF(LS_DEBUG, "Pushing event `{}` pointer: {}, dont broadcast: {}, post: {}\n", eventCopy->GetName(), eventCopy, bDontBroadcast, true);
+			EventInfo eventInfo{eventCopy, dontBroadcast};
 
-				hook->postHook->Notify(hook->name, &eventInfo, dontBroadcast);
+			hook->postHook->Notify(hook->name, &eventInfo, dontBroadcast);
 
-				g_pGameEventManager->FreeEvent(eventInfo.event);
+			g_pGameEventManager->FreeEvent(eventCopy);
+		} else if (hook->postHook != nullptr) {
+			hook->postHook->Notify(hook->name, nullptr, dontBroadcast);
+		}
 
-				m_eventCopies.pop();
-			} else {
-				hook->postHook->Notify(hook->name, nullptr, dontBroadcast);
+		// Only the last reference takes the lock, a hook registered again meanwhile is kept
+		if (--hook->refCount == 0) {
+			std::unique_lock<std::mutex> lock(m_registerEventLock);
+			if (hook->refCount == 0) {
+				RemoveEventHook(*hook);
 			}
 		}
+	}
 
-		if (--hook->refCount == 0) {
-			AssertFatal(hook->postHook == nullptr);
-			AssertFatal(hook->preHook == nullptr);
-			m_eventHooks.erase(hook->name);
-			delete hook;
+	return ResultType::Continue;
+}
+
+EventManager g_EventManager;
+
+CON_COMMAND_F(s2_event_rules_reload, "Reload the native event rules config", FCVAR_NONE) {
+	g_EventManager.ReloadEventRules();
+}
+
+CON_COMMAND_F(s2_event_record, "Record events to a file: s2_event_record <file> <event>[/key:type,...] ...", FCVAR_NONE) {
+	if (args.ArgC() < 3) {
+		S2_LOG(LS_WARNING, "Usage: s2_event_record <file> <event>[/key:type,...] ...\n");
+		return;
+	}
+
+	plg::vector<EventTemplate> templates;
+	for (int i = 2; i < args.ArgC(); ++i) {
+		std::string_view spec(args[i]);
+		auto separator = spec.find('/');
+
+		plg::string name(spec.substr(0, separator));
+		plg::vector<plg::string> keys;
+		plg::vector<EventFieldType> types;
+		if (separator != std::string_view::npos) {
+			for (const auto& pair : utils::split(spec.substr(separator + 1), ",")) {
+				auto colon = pair.find(':');
+				auto type = colon != std::string_view::npos ? ParseEventFieldType(pair.substr(colon + 1)) : std::nullopt;
+				if (!type) {
+					S2_LOGF(LS_WARNING, "Invalid field \"{}\" of event \"{}\"\n", pair, name);
+					return;
+				}
+				keys.emplace_back(pair.substr(0, colon));
+				types.push_back(*type);
+			}
 		}
+
+		auto handles = g_EventManager.ResolveEventKeys(name, keys);
+		if (handles.size() != keys.size()) {
+			S2_LOGF(LS_WARNING, "Unknown event \"{}\"\n", name);
+			return;
+		}
+
+		templates.emplace_back(std::move(name), std::move(handles), std::move(types));
 	}
 
-	m_eventStack.pop();
+	if (!g_EventManager.StartEventRecording(args[1], std::move(templates))) {
+		S2_LOGF(LS_WARNING, "Cannot record to \"{}\", a recording is already running or the file cannot be opened\n", args[1]);
+	}
+}
 
-	return ResultType::Continue;
+CON_COMMAND_F(s2_event_record_stop, "Stop recording events", FCVAR_NONE) {
+	if (!g_EventManager.StopEventRecording()) {
+		S2_LOG(LS_WARNING, "No event recording is running\n");
+	}
 }
 
-EventManager g_EventManager;
\ No newline at end of file
+CON_COMMAND_F(s2_event_replay, "Replay recorded events through the event hooks and print their cost, refused while clients are connected: s2_event_replay <file> [loops]", FCVAR_NONE) {
+	if (args.ArgC() < 2) {
+		S2_LOG(LS_WARNING, "Usage: s2_event_replay <file> [loops]\n");
+		return;
+	}
+
+	uint32_t loops = 1;
+	if (args.ArgC() > 2) {
+		loops = utils::string_to_int<uint32_t>(args[2]).value_or(loops);
+	}
+
+	// Replayed events reach the live handlers of every plugin, which may act on the players they name
+	for (int slot = 0; slot < PlayerManager::MaxClients(); ++slot) {
+		Player* player = g_PlayerManager.ToPlayer(CPlayerSlot(slot));
+		if (player != nullptr && player->IsConnected() && !player->IsFakeClient()) {
+			S2_LOG(LS_WARNING, "Cannot replay events while clients are connected\n");
+			return;
+		}
+	}
+
+	auto stats = EventReplayer::Replay(args[1], g_pGameEventManager, loops);
+	if (!stats) {
+		S2_LOGF(LS_WARNING, "Cannot replay \"{}\", the file is missing or not an event recording\n", args[1]);
+		return;
+	}
+
+	S2_LOGF(LS_MESSAGE, "Replayed {} events ({} blocked): total {:.3f} ms, avg {:.3f} us, max {:.3f} us\n",
+			stats->events, stats->blocked, static_cast<double>(stats->totalNs) / 1e6,
+			stats->events ? static_cast<double>(stats->totalNs) / static_cast<double>(stats->events) / 1e3 : 0.0,
+			static_cast<double>(stats->maxNs) / 1e3);
+}
\ No newline at end of file
@@ -12,14 +12,99 @@ using EventListenerCallback = ResultType (*)(const plg::string& name, EventInfo*
 
 using HookCallback = ListenerManager<EventListenerCallback>;
 
+struct EventStream;
+struct EventRule;
+class EventRecorder;
+
 struct EventHook {
 	plg::string name;
 	std::unique_ptr<HookCallback> preHook;
 	std::unique_ptr<HookCallback> postHook;
+	std::vector<EventStream*> streams;
+	const std::vector<EventRule>* rules{};
+	int recordIndex{-1};
 	uint32_t refCount{};
+	int id{-1};
 	bool postCopy{};
 };
 
+// Key symbol resolved once, the symbol points into name so keys never move or die
+struct EventKey {
+	explicit EventKey(const plg::string& key) : name(key), symbol(GameEventKeySymbol_t::Make(name.c_str())) {}
+	EventKey(const EventKey&) = delete;
+	EventKey& operator=(const EventKey&) = delete;
+
+	plg::string name;
+	GameEventKeySymbol_t symbol;
+};
+
+enum class EventFieldType : int {
+	Bool,
+	Float,
+	Int,
+	UInt64,
+	String,
+	Ptr,
+	PlayerIndex,
+	EntityIndex,
+	EntityHandle,
+};
+
+// Reusable set of typed fields for bulk reads and writes of an event
+struct EventTemplate {
+	plg::string name;
+	plg::vector<EventKey*> keys;
+	plg::vector<EventFieldType> types;
+};
+
+using EventStreamCallback = void (*)(uint32_t id, uint32_t count, const plg::vector<plg::any>& values, const plg::vector<plg::any>& userData);
+
+// Fields of every fire of one event captured into a ring and delivered once per frame.
+// When the ring is full the oldest record is overwritten and counted as dropped.
+struct EventStream {
+	uint32_t id{};
+	EventHook* hook{};
+	EventTemplate fields;
+	EventStreamCallback callback{};
+	plg::vector<plg::any> userData;
+	plg::vector<plg::any> ring;
+	uint32_t capacity{};
+	uint32_t head{};
+	uint32_t count{};
+	uint64_t dropped{};
+	bool removed{};
+};
+
+enum class EventRuleOp : int {
+	Equal,
+	NotEqual,
+	Less,
+	LessEqual,
+	Greater,
+	GreaterEqual,
+};
+
+enum class EventRuleAction : int {
+	Block,
+	DontBroadcast,
+	Set,
+};
+
+struct EventRuleCondition {
+	EventKey* key{};
+	EventFieldType type{};
+	EventRuleOp op{};
+	plg::any value;
+};
+
+// Native filter from the event rules config, runs before plugin pre hooks when all of its conditions match
+struct EventRule {
+	plg::vector<EventRuleCondition> conditions;
+	EventRuleAction action{};
+	EventTemplate setFields;
+	plg::vector<plg::any> setValues;
+};
+
 enum class EventHookError : int {
 	Okay = 0,
 	InvalidEvent,
@@ -29,7 +114,7 @@ enum class EventHookError : int {
 
 class EventManager : public IGameEventListener2 {
 public:
-	EventManager() = default;
+	EventManager();
 	~EventManager() override;
 
 	EventHookError HookEvent(const plg::string& name, EventListenerCallback callback, HookMode mode = HookMode::Post);
@@ -40,17 +125,72 @@ public:
 	void FireEventToClient(EventInfo* info, CPlayerSlot slot);
 	void CancelCreatedEvent(EventInfo* info);
 
+	plg::vector<EventKey*> ResolveEventKeys(const plg::string& name, const plg::vector<plg::string>& keys);
+
+	EventTemplate* CreateEventTemplate(const plg::string& name, const plg::vector<plg::string>& keys, const plg::vector<EventFieldType>& types);
+	bool DestroyEventTemplate(EventTemplate* eventTemplate);
+	EventInfo* CreateEvent(const EventTemplate& eventTemplate, const plg::vector<plg::any>& values, bool force = false);
+
+	static plg::vector<plg::any> ReadEventFields(IGameEvent* event, const EventTemplate& eventTemplate);
+	static void ReadEventFields(IGameEvent* event, const EventTemplate& eventTemplate, plg::any* values);
+	static void WriteEventFields(IGameEvent* event, const EventTemplate& eventTemplate, const plg::vector<plg::any>& values);
+
 	ResultType OnFireEvent(IGameEvent* event, bool dontBroadcast);
 	ResultType OnFireEvent_Post(IGameEvent* event, bool dontBroadcast);
 
+	uint32_t CreateEventStream(const plg::string& name, const plg::vector<plg::string>& keys, const plg::vector<EventFieldType>& types, uint32_t capacity, EventStreamCallback callback, const plg::vector<plg::any>& userData);
+	bool DestroyEventStream(uint32_t id);
+	uint64_t GetEventStreamDropCount(uint32_t id) const;
+	void FlushEventStreams();
+
+	bool StartEventRecording(const plg::string& path, plg::vector<EventTemplate> templates);
+	bool StopEventRecording();
+
+	bool LoadEventRules(plg::vector<plg::string> paths);
+	bool ReloadEventRules();
+
+	void RebuildEventIndex();
+
+	uint64_t GetAvoidedDuplicateCount() const { return m_avoidedDuplicateCount; }
+
 private:
 	void FireGameEvent(IGameEvent* event) override;
 
+	EventHook* FindOrCreateEventHook(const plg::string& name);
+	void ReleaseEventHook(EventHook& eventHook);
+	void RemoveEventHook(EventHook& eventHook);
+	void IndexEventHook(EventHook& eventHook);
+	void UnindexEventHook(const EventHook& eventHook);
+
+	EventKey* InternEventKey(const plg::string& key);
+
+	static void CaptureEvent(IGameEvent* event, EventStream& stream);
+	static bool MatchEventRule(IGameEvent* event, const EventRule& rule);
+
 private:
+	// One frame per event in flight, pre and post callbacks of nested fires pair up through it
+	struct EventFrame {
+		EventHook* hook{};
+		// Copy (or superseded original) owned until the post callbacks are done
+		IGameEvent* event{};
+	};
+
 	std::unordered_map<plg::string, EventHook> m_eventHooks;
+	// Hooks by descriptor id, so firing an event never touches its name
+	std::vector<EventHook*> m_eventIndex;
+	std::unordered_map<plg::string, std::unique_ptr<EventKey>> m_eventKeys;
+	std::vector<std::unique_ptr<EventTemplate>> m_eventTemplates;
+	std::vector<std::unique_ptr<EventStream>> m_eventStreams;
+	// Rules by event name, replaced as a whole on reload
+	std::unique_ptr<std::unordered_map<plg::string, std::vector<EventRule>>> m_eventRules;
+	plg::vector<plg::string> m_eventRulesPaths;
+	std::unique_ptr<EventRecorder> m_eventRecorder;
+	plg::vector<plg::any> m_streamBatch;
+	uint32_t m_nextStreamId{};
+	bool m_flushingStreams{};
 	std::stack<EventInfo*> m_freeEvents;
-	std::stack<EventHook*> m_eventStack;
-	std::stack<IGameEvent*> m_eventCopies;
+	std::stack<EventFrame> m_eventStack;
+	uint64_t m_avoidedDuplicateCount{};
 	std::mutex m_registerEventLock;
 };
 
@@ -0,0 +1,297 @@
+#include "event_recorder.hpp"
+
+namespace {
+	template<typename T>
+	void WriteValue(std::vector<char>& buffer, T value) {
+		const char* bytes = reinterpret_cast<const char*>(&value);
+		buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+	}
+
+	void WriteString(std::vector<char>& buffer, std::string_view value) {
+		auto size = static_cast<uint16_t>(std::min<size_t>(value.size(), UINT16_MAX));
+		WriteValue(buffer, size);
+		buffer.insert(buffer.end(), value.data(), value.data() + size);
+	}
+
+	template<typename T>
+	bool ReadValue(std::ifstream& file, T& value) {
+		return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+	}
+
+	bool ReadString(std::ifstream& file, plg::string& value) {
+		uint16_t size;
+		if (!ReadValue(file, size)) {
+			return false;
+		}
+		value.resize(size);
+		return static_cast<bool>(file.read(value.data(), size));
+	}
+
+	bool ReadField(std::ifstream& file, EventFieldType type, plg::any& value) {
+		switch (type) {
+			case EventFieldType::Bool: {
+				uint8_t v;
+				if (!ReadValue(file, v)) return false;
+				value = v != 0;
+				return true;
+			}
+			case EventFieldType::Float: {
+				float v;
+				if (!ReadValue(file, v)) return false;
+				value = v;
+				return true;
+			}
+			case EventFieldType::UInt64: {
+				uint64_t v;
+				if (!ReadValue(file, v)) return false;
+				value = v;
+				return true;
+			}
+			case EventFieldType::String: {
+				plg::string v;
+				if (!ReadString(file, v)) return false;
+				value = std::move(v);
+				return true;
+			}
+			case EventFieldType::Ptr:
+				// Pointers mean nothing outside the recorded process, only the field is kept
+				value = static_cast<void*>(nullptr);
+				return true;
+			default: {
+				int32_t v;
+				if (!ReadValue(file, v)) return false;
+				value = static_cast<int>(v);
+				return true;
+			}
+		}
+	}
+
+	// Bytes left after the read position, so counts from the file can be checked before anything is allocated
+	uint64_t RemainingBytes(std::ifstream& file, uint64_t size) {
+		auto pos = file.tellg();
+		return pos < 0 || static_cast<uint64_t>(pos) > size ? 0 : size - static_cast<uint64_t>(pos);
+	}
+
+	struct RecordedTemplate {
+		plg::string name;
+		plg::vector<plg::string> keys;
+		plg::vector<EventFieldType> types;
+	};
+
+	bool ReadHeader(std::ifstream& file, uint64_t size, std::vector<RecordedTemplate>& recorded) {
+		uint32_t magic, version, templateCount;
+		if (!ReadValue(file, magic) || !ReadValue(file, version) || !ReadValue(file, templateCount) ||
+			magic != EventRecorder::FILE_MAGIC || version != EventRecorder::FILE_VERSION) {
+			return false;
+		}
+
+		// A template takes at least a name length and a field count, a field at least a key length and a type
+		if (templateCount > RemainingBytes(file, size) / (sizeof(uint16_t) + sizeof(uint16_t))) {
+			return false;
+		}
+
+		recorded.resize(templateCount);
+		for (auto& eventTemplate : recorded) {
+			uint16_t fieldCount;
+			if (!ReadString(file, eventTemplate.name) || !ReadValue(file, fieldCount) ||
+				fieldCount > RemainingBytes(file, size) / (sizeof(uint16_t) + sizeof(uint8_t))) {
+				return false;
+			}
+
+			eventTemplate.keys.resize(fieldCount);
+			eventTemplate.types.resize(fieldCount);
+			for (uint16_t i = 0; i < fieldCount; ++i) {
+				uint8_t type;
+				if (!ReadString(file, eventTemplate.keys[i]) || !ReadValue(file, type)) {
+					return false;
+				}
+				eventTemplate.types[i] = static_cast<EventFieldType>(type);
+			}
+		}
+
+		return true;
+	}
+
+	struct ReplayRecord {
+		uint32_t index;
+		bool dontBroadcast;
+		plg::vector<plg::any> values;
+	};
+} // namespace
+
+std::unique_ptr<EventRecorder> EventRecorder::Open(const plg::string& path, plg::vector<EventTemplate> templates) {
+	std::ofstream file(path.c_str(), std::ios::binary | std::ios::trunc);
+	if (!file) {
+		return nullptr;
+	}
+
+	return std::unique_ptr<EventRecorder>(new EventRecorder(std::move(file), std::move(templates)));
+}
+
+EventRecorder::EventRecorder(std::ofstream file, plg::vector<EventTemplate> templates) : m_file(std::move(file)), m_templates(std::move(templates)) {
+	WriteValue(m_buffer, FILE_MAGIC);
+	WriteValue(m_buffer, FILE_VERSION);
+	WriteValue(m_buffer, static_cast<uint32_t>(m_templates.size()));
+	for (const auto& eventTemplate : m_templates) {
+		WriteString(m_buffer, eventTemplate.name);
+		WriteValue(m_buffer, static_cast<uint16_t>(eventTemplate.keys.size()));
+		for (size_t i = 0; i < eventTemplate.keys.size(); ++i) {
+			WriteString(m_buffer, eventTemplate.keys[i]->name);
+			WriteValue(m_buffer, static_cast<uint8_t>(eventTemplate.types[i]));
+		}
+	}
+
+	m_file.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+}
+
+void EventRecorder::Write(IGameEvent* event, uint32_t index, bool dontBroadcast, int tick) {
+	const auto& eventTemplate = m_templates[index];
+
+	m_buffer.clear();
+	WriteValue(m_buffer, static_cast<int32_t>(tick));
+	WriteValue(m_buffer, static_cast<uint16_t>(index));
+	WriteValue(m_buffer, static_cast<uint8_t>(dontBroadcast));
+
+	for (size_t i = 0; i < eventTemplate.keys.size(); ++i) {
+		const auto& key = eventTemplate.keys[i]->symbol;
+		switch (eventTemplate.types[i]) {
+			case EventFieldType::Bool:
+				WriteValue(m_buffer, static_cast<uint8_t>(event->GetBool(key)));
+				break;
+			case EventFieldType::Float:
+				WriteValue(m_buffer, event->GetFloat(key));
+				break;
+			case EventFieldType::Int:
+				WriteValue(m_buffer, static_cast<int32_t>(event->GetInt(key)));
+				break;
+			case EventFieldType::UInt64:
+				WriteValue(m_buffer, static_cast<uint64_t>(event->GetUint64(key)));
+				break;
+			case EventFieldType::String:
+				WriteString(m_buffer, event->GetString(key));
+				break;
+			case EventFieldType::Ptr:
+				break;
+			case EventFieldType::PlayerIndex:
+				WriteValue(m_buffer, static_cast<int32_t>(event->GetPlayerSlot(key).Get()));
+				break;
+			case EventFieldType::EntityIndex:
+				WriteValue(m_buffer, static_cast<int32_t>(event->GetEntityIndex(key).Get()));
+				break;
+			case EventFieldType::EntityHandle:
+				WriteValue(m_buffer, static_cast<int32_t>(event->GetEHandle(key).ToInt()));
+				break;
+		}
+	}
+
+	m_file.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+	++m_count;
+}
+
+std::optional<EventReplayStats> EventReplayer::Replay(const plg::string& path, IGameEventManager2* manager, uint32_t loops) {
+	std::ifstream file(path.c_str(), std::ios::binary | std::ios::ate);
+	if (!file) {
+		return std::nullopt;
+	}
+
+	auto size = static_cast<uint64_t>(std::max<std::streamoff>(file.tellg(), 0));
+	file.seekg(0);
+
+	std::vector<RecordedTemplate> recorded;
+	if (!ReadHeader(file, size, recorded)) {
+		return std::nullopt;
+	}
+
+	// Everything is loaded up front so file reads stay out of the measured dispatch
+	std::vector<ReplayRecord> records;
+	for (;;) {
+		int32_t tick;
+		uint16_t index;
+		uint8_t dontBroadcast;
+		if (!ReadValue(file, tick)) {
+			break;
+		}
+		if (!ReadValue(file, index) || !ReadValue(file, dontBroadcast) || index >= recorded.size()) {
+			return std::nullopt;
+		}
+
+		const auto& eventTemplate = recorded[index];
+		auto& record = records.emplace_back(index, dontBroadcast != 0, plg::vector<plg::any>(eventTemplate.keys.size()));
+		for (size_t i = 0; i < eventTemplate.keys.size(); ++i) {
+			if (!ReadField(file, eventTemplate.types[i], record.values[i])) {
+				return std::nullopt;
+			}
+		}
+	}
+
+	// Event ids and key checks come from the replay manager, the hook index follows it for the duration
+	IGameEventManager2* engineManager = g_pGameEventManager;
+	g_pGameEventManager = manager;
+	g_EventManager.RebuildEventIndex();
+
+	plg::vector<EventTemplate> templates;
+	templates.reserve(recorded.size());
+	for (const auto& eventTemplate : recorded) {
+		templates.emplace_back(eventTemplate.name, g_EventManager.ResolveEventKeys(eventTemplate.name, eventTemplate.keys), eventTemplate.types);
+	}
+
+	EventReplayStats stats;
+	for (uint32_t loop = 0; loop < loops; ++loop) {
+		for (const auto& record : records) {
+			const auto& eventTemplate = templates[record.index];
+			// Unknown to the replay manager
+			if (eventTemplate.keys.size() != eventTemplate.types.size()) {
+				continue;
+			}
+
+			IGameEvent* event = manager->CreateEvent(eventTemplate.name.c_str(), true);
+			if (!event) {
+				continue;
+			}
+
+			EventManager::WriteEventFields(event, eventTemplate, record.values);
+
+			// Same order as the engine: pre hooks, the fire itself frees the event, then post hooks
+			auto start = std::chrono::steady_clock::now();
+			auto result = g_EventManager.OnFireEvent(event, record.dontBroadcast);
+			if (result < ResultType::Handled) {
+				manager->FreeEvent(event);
+			} else {
+				++stats.blocked;
+			}
+			g_EventManager.OnFireEvent_Post(event, record.dontBroadcast);
+			auto elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+
+			++stats.events;
+			stats.totalNs += elapsed;
+			stats.maxNs = std::max(stats.maxNs, elapsed);
+		}
+	}
+
+	g_pGameEventManager = engineManager;
+	g_EventManager.RebuildEventIndex();
+
+	return stats;
+}
+
+std::optional<plg::vector<plg::string>> EventReplayer::ReadEventNames(const plg::string& path) {
+	std::ifstream file(path.c_str(), std::ios::binary | std::ios::ate);
+	if (!file) {
+		return std::nullopt;
+	}
+
+	auto size = static_cast<uint64_t>(std::max<std::streamoff>(file.tellg(), 0));
+	file.seekg(0);
+
+	std::vector<RecordedTemplate> recorded;
+	if (!ReadHeader(file, size, recorded)) {
+		return std::nullopt;
+	}
+
+	plg::vector<plg::string> names;
+	names.reserve(recorded.size());
+	for (auto& eventTemplate : recorded) {
+		names.emplace_back(std::move(eventTemplate.name));
+	}
+	return names;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "event_manager.hpp"
+#include <fstream>
+
+// Appends fired events to a compact binary file: a header with the recorded event templates,
+// then one record per fire with the tick, template index, broadcast flag and field values.
+class EventRecorder {
+public:
+	static constexpr uint32_t FILE_MAGIC = 0x56453253; // "S2EV"
+	static constexpr uint32_t FILE_VERSION = 1;
+
+	static std::unique_ptr<EventRecorder> Open(const plg::string& path, plg::vector<EventTemplate> templates);
+
+	void Write(IGameEvent* event, uint32_t index, bool dontBroadcast, int tick);
+
+	const plg::vector<EventTemplate>& GetTemplates() const { return m_templates; }
+	uint64_t GetCount() const { return m_count; }
+
+private:
+	EventRecorder(std::ofstream file, plg::vector<EventTemplate> templates);
+
+private:
+	std::ofstream m_file;
+	plg::vector<EventTemplate> m_templates;
+	std::vector<char> m_buffer;
+	uint64_t m_count{};
+};
+
+struct EventReplayStats {
+	uint64_t events{};
+	uint64_t blocked{};
+	uint64_t totalNs{};
+	uint64_t maxNs{};
+};
+
+// Feeds a recording through the EventManager hook dispatch as fast as possible to measure handler cost.
+// Events are created on the given manager, which stands in for the engine one during the replay,
+// so a mocked IGameEventManager2 can drive the plugin hooks without a running game (see tools/event_replay).
+class EventReplayer {
+public:
+	static std::optional<EventReplayStats> Replay(const plg::string& path, IGameEventManager2* manager, uint32_t loops = 1);
+	// Names of the recorded events, so a harness can hook them before replaying
+	static std::optional<plg::vector<plg::string>> ReadEventNames(const plg::string& path);
+};
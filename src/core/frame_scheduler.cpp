@@ -0,0 +1,102 @@
+#include "frame_scheduler.hpp"
+#include "timer_system.hpp"
+
+#include <convar.h>
+
+CConVar<double> s2_frame_budget("s2_frame_budget", FCVAR_NONE, "Share of the tick interval that scheduled frame work may use per tick before low priority work is shed. Pass 0 to never shed.", 0.5);
+
+uint32_t FrameScheduler::AddWork(FramePhase phase, FrameWorkCallback callback, FramePriority priority, double deadline, const plg::vector<plg::any>& userData) {
+	if (phase < FramePhase::GameFrame || phase >= FramePhase::Count || callback == nullptr)
+		return 0;
+
+	uint32_t id = ++m_nextId;
+	m_added[static_cast<size_t>(phase)].emplace_back(id, priority, deadline, callback, userData, std::chrono::steady_clock::now(), false);
+
+	if (!m_running) {
+		MergeAdded(phase);
+	}
+
+	return id;
+}
+
+bool FrameScheduler::RemoveWork(uint32_t id) {
+	for (size_t phase = 0; phase < m_work.size(); ++phase) {
+		for (auto* list : {&m_work[phase], &m_added[phase]}) {
+			auto it = std::find_if(list->begin(), list->end(), [id](const FrameWork& work) { return work.id == id && !work.removed; });
+			if (it == list->end())
+				continue;
+
+			// Entries are only erased outside of Run, so the running loop never sees a shifted vector
+			if (m_running) {
+				it->removed = true;
+			} else {
+				list->erase(it);
+			}
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FrameScheduler::Run(FramePhase phase, const FrameContext& context) {
+	auto& works = m_work[static_cast<size_t>(phase)];
+
+	auto start = std::chrono::steady_clock::now();
+	if (phase == FramePhase::GameFrame) {
+		m_tickUsed = {};
+	}
+
+	m_context = context;
+	m_running = true;
+
+	auto budget = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(TimerSystem::GetTickedInterval() * s2_frame_budget.Get()));
+	auto now = start;
+
+	for (auto& work : works) {
+		if (work.removed)
+			continue;
+
+		if (work.priority != FramePriority::Critical && budget.count() > 0 && m_tickUsed + (now - start) > budget) {
+			std::chrono::duration<double, std::milli> waited = now - work.lastRun;
+			if (work.deadline <= 0.0 || waited.count() < work.deadline) {
+				++m_shedCount;
+				continue;
+			}
+		}
+
+		work.callback(work.id, context.simulating, work.userData);
+
+		now = std::chrono::steady_clock::now();
+		work.lastRun = now;
+	}
+
+	m_tickUsed += now - start;
+	m_running = false;
+
+	for (size_t i = 0; i < m_work.size(); ++i) {
+		std::erase_if(m_work[i], [](const FrameWork& work) { return work.removed; });
+		MergeAdded(static_cast<FramePhase>(i));
+	}
+}
+
+void FrameScheduler::MergeAdded(FramePhase phase) {
+	auto& added = m_added[static_cast<size_t>(phase)];
+	if (added.empty())
+		return;
+
+	auto& works = m_work[static_cast<size_t>(phase)];
+	for (auto& work : added) {
+		if (!work.removed) {
+			works.emplace_back(std::move(work));
+		}
+	}
+	added.clear();
+
+	// Ids grow with registration, so equal priorities keep their registration order
+	std::sort(works.begin(), works.end(), [](const FrameWork& a, const FrameWork& b) {
+		return std::tie(a.priority, a.id) < std::tie(b.priority, b.id);
+	});
+}
+
+FrameScheduler g_FrameScheduler;
\ No newline at end of file
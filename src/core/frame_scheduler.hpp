@@ -0,0 +1,61 @@
+#pragma once
+
+enum class FramePhase : int {
+	GameFrame,
+	PreWorldUpdate,
+	Count
+};
+
+// Lower values run first, Critical work is never shed
+enum class FramePriority : int {
+	Critical,
+	High,
+	Normal,
+	Low,
+};
+
+struct FrameContext {
+	bool simulating;
+	bool firstTick;
+	bool lastTick;
+};
+
+using FrameWorkCallback = void (*)(uint32_t, bool, const plg::vector<plg::any>&);
+
+// Runs the per-frame work of every phase in priority order.
+// Once the work of a tick has used its share of the tick interval, non-critical work is shed for that tick,
+// unless it has waited longer than its deadline, so the server holds tick rate under load. Main thread only.
+class FrameScheduler {
+public:
+	uint32_t AddWork(FramePhase phase, FrameWorkCallback callback, FramePriority priority = FramePriority::Normal, double deadline = 0.0, const plg::vector<plg::any>& userData = {});
+	bool RemoveWork(uint32_t id);
+
+	void Run(FramePhase phase, const FrameContext& context);
+
+	const FrameContext& GetContext() const { return m_context; }
+	uint64_t GetShedCount() const { return m_shedCount; }
+
+private:
+	struct FrameWork {
+		uint32_t id;
+		FramePriority priority;
+		double deadline;
+		FrameWorkCallback callback;
+		plg::vector<plg::any> userData;
+		std::chrono::steady_clock::time_point lastRun;
+		bool removed;
+	};
+
+	void MergeAdded(FramePhase phase);
+
+private:
+	std::array<std::vector<FrameWork>, static_cast<size_t>(FramePhase::Count)> m_work;
+	std::array<std::vector<FrameWork>, static_cast<size_t>(FramePhase::Count)> m_added;
+	FrameContext m_context{};
+	std::chrono::steady_clock::duration m_tickUsed{};
+	uint64_t m_shedCount{};
+	uint32_t m_nextId{};
+	bool m_running{};
+};
+
+extern FrameScheduler g_FrameScheduler;
\ No newline at end of file
@@ -1,6 +1,7 @@
 
 #include "globals.hpp"
 #include "core_config.hpp"
+#include "event_manager.hpp"
 #include "game_config.hpp"
 #include "hook_holder.hpp"
 
@@ -57,6 +58,12 @@ namespace globals {
 		}
 		g_pGameEventManager = *p_ppGameEventManager;
 
+		g_EventManager.LoadEventRules(plg::vector{
+				paths["base"] + "/event_rules.jsonc",
+				paths["configs"] + "/event_rules.jsonc",
+				paths["data"] + "/event_rules.jsonc"
+		});
+
 		g_pCVar = static_cast<ICvar*>(QueryInterface("tier0", CVAR_INTERFACE_VERSION));
 		g_pSchemaSystem = static_cast<ISchemaSystem*>(QueryInterface("schemasystem", SCHEMASYSTEM_INTERFACE_VERSION));
 		g_pSource2Server = static_cast<ISource2Server*>(QueryInterface("server", SOURCE2SERVER_INTERFACE_VERSION));
@@ -14,83 +14,414 @@ enum class ResultType : int {
 	Stop = 4,
 };
 
+// Stable id of a registered listener: slot in the high half and generation in the low half, 0 is never valid
+using ListenerHandle = uint64_t;
+
+struct ListenerStats {
+	plg::string manager;
+	uintptr_t callback;
+	uint64_t calls;
+	uint64_t totalNs;
+	uint64_t maxNs;
+};
+
+// Type-erased side of every ListenerManager, keeps a registry of live managers for cost accounting.
+// Timing is off by default, dispatch then pays a single relaxed load per callback.
+class ListenerManagerBase {
+public:
+	explicit ListenerManagerBase(plg::string name = {}) : m_name(std::move(name)) {
+		auto& registry = GetRegistry();
+		std::lock_guard<std::mutex> lock(registry.lock);
+		registry.managers.push_back(this);
+	}
+
+	virtual ~ListenerManagerBase() {
+		auto& registry = GetRegistry();
+		std::lock_guard<std::mutex> lock(registry.lock);
+		std::erase(registry.managers, this);
+	}
+
+	ListenerManagerBase(const ListenerManagerBase&) = delete;
+	ListenerManagerBase& operator=(const ListenerManagerBase&) = delete;
+
+	virtual void CollectStats(std::vector<ListenerStats>& stats) const = 0;
+	virtual void ResetStats() = 0;
+
+	const plg::string& GetName() const { return m_name; }
+	void SetName(plg::string name) { m_name = std::move(name); }
+
+	static bool IsProfiling() { return s_profiling.load(std::memory_order_relaxed); }
+	static void SetProfiling(bool enable) { s_profiling.store(enable, std::memory_order_relaxed); }
+
+	static std::vector<ListenerStats> CollectAllStats() {
+		std::vector<ListenerStats> stats;
+		auto& registry = GetRegistry();
+		std::lock_guard<std::mutex> lock(registry.lock);
+		for (const auto* manager : registry.managers) {
+			manager->CollectStats(stats);
+		}
+		return stats;
+	}
+
+	static void ResetAllStats() {
+		auto& registry = GetRegistry();
+		std::lock_guard<std::mutex> lock(registry.lock);
+		for (auto* manager : registry.managers) {
+			manager->ResetStats();
+		}
+	}
+
+private:
+	struct Registry {
+		std::mutex lock;
+		std::vector<ListenerManagerBase*> managers;
+	};
+
+	// Never freed, managers with static storage unregister during shutdown in any order
+	static Registry& GetRegistry() {
+		static auto* registry = new Registry();
+		return *registry;
+	}
+
+	plg::string m_name;
+
+	static inline std::atomic<bool> s_profiling{};
+};
+
 template<class = void>
 class ListenerManager;
 
 template<class Ret, class... Args>
-class ListenerManager<Ret (*)(Args...)> {
+class ListenerManager<Ret (*)(Args...)> final : public ListenerManagerBase {
 public:
 	using Func = Ret (*)(Args...);
 
+	struct Listener {
+		Func func;
+		ListenerHandle handle;
+		int priority;
+		int group;
+		std::atomic<bool> active;
+		mutable std::atomic<uint64_t> calls;
+		mutable std::atomic<uint64_t> totalNs;
+		mutable std::atomic<uint64_t> maxNs;
+	};
+
+	// Immutable view of the listeners taken at the start of a dispatch.
+	// Registering while it is alive publishes a new array and leaves this one intact,
+	// listeners unregistered during the dispatch are skipped from then on.
+	class Snapshot {
+	public:
+		class Iterator {
+		public:
+			Iterator(Listener* const* it, Listener* const* end) : m_it(it), m_end(end) {
+				Skip();
+			}
+
+			const Listener& operator*() const { return **m_it; }
+
+			Iterator& operator++() {
+				++m_it;
+				Skip();
+				return *this;
+			}
+
+			bool operator==(const Iterator& other) const { return m_it == other.m_it; }
+
+		private:
+			void Skip() {
+				while (m_it != m_end && !(*m_it)->active.load(std::memory_order_acquire)) {
+					++m_it;
+				}
+			}
+
+			Listener* const* m_it;
+			Listener* const* m_end;
+		};
+
+		explicit Snapshot(const ListenerManager& manager) : m_manager(manager) {
+			m_manager.m_readers.fetch_add(1, std::memory_order_seq_cst);
+			m_listeners = m_manager.m_snapshot.load(std::memory_order_seq_cst);
+		}
+
+		~Snapshot() {
+			m_manager.m_readers.fetch_sub(1, std::memory_order_release);
+		}
+
+		Snapshot(const Snapshot&) = delete;
+		Snapshot& operator=(const Snapshot&) = delete;
+
+		Iterator begin() const {
+			return {m_listeners->data(), m_listeners->data() + m_listeners->size()};
+		}
+
+		Iterator end() const {
+			return {m_listeners->data() + m_listeners->size(), m_listeners->data() + m_listeners->size()};
+		}
+
+		Ret Notify(const Listener& listener, Args... args) const {
+			if (!IsProfiling()) [[likely]] {
+				return listener.func(std::forward<Args>(args)...);
+			}
+
+			ScopedTiming timing{listener, std::chrono::steady_clock::now()};
+			return listener.func(std::forward<Args>(args)...);
+		}
+
+		bool Empty() const {
+			return begin() == end();
+		}
+
+	private:
+		struct ScopedTiming {
+			const Listener& listener;
+			std::chrono::steady_clock::time_point start;
+
+			~ScopedTiming() {
+				auto elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+				listener.calls.fetch_add(1, std::memory_order_relaxed);
+				listener.totalNs.fetch_add(elapsed, std::memory_order_relaxed);
+				uint64_t max = listener.maxNs.load(std::memory_order_relaxed);
+				while (elapsed > max && !listener.maxNs.compare_exchange_weak(max, elapsed, std::memory_order_relaxed)) {
+				}
+			}
+		};
+
+		const ListenerManager& m_manager;
+		const std::vector<Listener*>* m_listeners;
+	};
+
+	explicit ListenerManager(plg::string name = {}) : ListenerManagerBase(std::move(name)) {
+	}
+
+	~ListenerManager() override {
+		auto* listeners = m_snapshot.load(std::memory_order_relaxed);
+		for (auto* listener : *listeners) {
+			delete listener;
+		}
+		delete listeners;
+		FreeRetired();
+	}
+
+	// Listeners run by ascending group, then ascending priority, then registration order.
+	// Returns a handle for Unregister, or 0 if the callable is already registered.
 	template<typename Callable>
-	bool Register(Callable&& callable)
+	ListenerHandle Register(Callable&& callable, int priority = 0, int group = 0)
 		requires std::invocable<Callable, Args...>
 	{
+		std::lock_guard<std::mutex> lock(m_writeLock);
+		const auto& listeners = *m_snapshot.load(std::memory_order_relaxed);
 		// Is the callable already in the vector?
-		if (IsRegistered(callable)) {
+		if (FindActive(listeners, callable) != nullptr) {
 			//S2_LOG(LS_WARNING, "Callback already registered.\n");
-			return false;
-		} else {
-			m_callables.emplace_back(callable);
-			return true;
+			return 0;
+		}
+
+		auto* listener = new Listener{callable, AllocateHandle(), priority, group, true};
+		m_slots[SlotOf(listener->handle)] = listener;
+
+		// The copy is needed anyway, so it also drops the listeners unregistered since the last one
+		auto* copy = new std::vector<Listener*>();
+		copy->reserve(listeners.size() - m_inactive + 1);
+		for (auto* other : listeners) {
+			if (other->active.load(std::memory_order_relaxed)) {
+				copy->push_back(other);
+			} else {
+				m_retiredListeners.push_back(other);
+			}
 		}
+		m_inactive = 0;
+
+		auto it = std::upper_bound(copy->begin(), copy->end(), listener, [](const Listener* a, const Listener* b) {
+			return std::tie(a->group, a->priority) < std::tie(b->group, b->priority);
+		});
+		copy->insert(it, listener);
+
+		m_count.fetch_add(1, std::memory_order_relaxed);
+		Publish(copy);
+		return listener->handle;
 	}
 
 	template<typename Callable>
 	bool Unregister(Callable&& callable)
 		requires std::invocable<Callable, Args...>
 	{
-		auto index = Find(callable);
-		if (index == -1) {
+		std::lock_guard<std::mutex> lock(m_writeLock);
+		auto* listener = FindActive(*m_snapshot.load(std::memory_order_relaxed), callable);
+		if (listener == nullptr) {
 			//S2_LOG(LS_WARNING, "Callback not registered.\n");
 			return false;
-		} else {
-			m_callables.erase(m_callables.begin() + index);
-			return true;
 		}
+
+		Deactivate(listener);
+		return true;
 	}
 
-	template<typename Callable>
-	ptrdiff_t Find(Callable&& callable) const {
-		for (size_t i = 0; i < m_callables.size(); ++i) {
-			if (callable == m_callables[i]) {
-				return static_cast<ptrdiff_t>(i);
-			}
+	bool Unregister(ListenerHandle handle) {
+		std::lock_guard<std::mutex> lock(m_writeLock);
+		size_t slot = SlotOf(handle);
+		if (handle == 0 || slot >= m_slots.size() || m_slots[slot] == nullptr || m_slots[slot]->handle != handle) {
+			return false;
 		}
-		return -1;
+
+		Deactivate(m_slots[slot]);
+		return true;
 	}
 
 	template<typename Callable>
 	bool IsRegistered(Callable&& callable) const {
-		return Find(callable) != -1;
-	}
-
-	void Notify(Args... args) const {
-		for (size_t i = 0; i < m_callables.size(); ++i) {
-			m_callables[i](std::forward<Args>(args)...);
+		Snapshot snapshot(*this);
+		for (const auto& listener : snapshot) {
+			if (callable == listener.func) {
+				return true;
+			}
 		}
+		return false;
 	}
 
-	Ret Notify(size_t index, Args... args) const {
-		return m_callables[index](std::forward<Args>(args)...);
+	Snapshot GetSnapshot() const {
+		return Snapshot(*this);
 	}
 
-	Ret operator()(size_t index, Args... args) const {
-		return m_callables[index](std::forward<Args>(args)...);
+	void Notify(Args... args) const {
+		Snapshot snapshot(*this);
+		for (const auto& listener : snapshot) {
+			snapshot.Notify(listener, std::forward<Args>(args)...);
+		}
 	}
 
 	void Clear() {
-		m_callables.clear();
+		std::lock_guard<std::mutex> lock(m_writeLock);
+		for (auto* listener : *m_snapshot.load(std::memory_order_relaxed)) {
+			if (listener->active.load(std::memory_order_relaxed)) {
+				listener->active.store(false, std::memory_order_release);
+				ReleaseSlot(listener->handle);
+			}
+			m_retiredListeners.push_back(listener);
+		}
+		m_inactive = 0;
+		m_count.store(0, std::memory_order_relaxed);
+		Publish(new std::vector<Listener*>());
 	}
 
 	size_t GetCount() const {
-		return m_callables.size();
+		return m_count.load(std::memory_order_relaxed);
 	}
 
 	bool Empty() const {
-		return m_callables.empty();
+		return GetCount() == 0;
+	}
+
+	void CollectStats(std::vector<ListenerStats>& stats) const override {
+		Snapshot snapshot(*this);
+		for (const auto& listener : snapshot) {
+			stats.emplace_back(GetName(), reinterpret_cast<uintptr_t>(listener.func),
+							   listener.calls.load(std::memory_order_relaxed),
+							   listener.totalNs.load(std::memory_order_relaxed),
+							   listener.maxNs.load(std::memory_order_relaxed));
+		}
+	}
+
+	void ResetStats() override {
+		Snapshot snapshot(*this);
+		for (const auto& listener : snapshot) {
+			listener.calls.store(0, std::memory_order_relaxed);
+			listener.totalNs.store(0, std::memory_order_relaxed);
+			listener.maxNs.store(0, std::memory_order_relaxed);
+		}
+	}
+
+private:
+	static size_t SlotOf(ListenerHandle handle) {
+		return static_cast<size_t>(handle >> 32) - 1;
+	}
+
+	template<typename Callable>
+	static Listener* FindActive(const std::vector<Listener*>& listeners, Callable&& callable) {
+		for (auto* listener : listeners) {
+			if (callable == listener->func && listener->active.load(std::memory_order_relaxed)) {
+				return listener;
+			}
+		}
+		return nullptr;
+	}
+
+	ListenerHandle AllocateHandle() {
+		size_t slot;
+		if (m_freeSlots.empty()) {
+			slot = m_slots.size();
+			m_slots.push_back(nullptr);
+			m_generations.push_back(1);
+		} else {
+			slot = m_freeSlots.back();
+			m_freeSlots.pop_back();
+		}
+		return (static_cast<ListenerHandle>(slot + 1) << 32) | m_generations[slot];
+	}
+
+	void ReleaseSlot(ListenerHandle handle) {
+		size_t slot = SlotOf(handle);
+		m_slots[slot] = nullptr;
+		if (++m_generations[slot] == 0) {
+			m_generations[slot] = 1;
+		}
+		m_freeSlots.push_back(slot);
+	}
+
+	// Called with the write lock held. The listener stays in the published array as a tombstone,
+	// the array is compacted once tombstones outnumber live listeners, so removal is O(1) amortised.
+	void Deactivate(Listener* listener) {
+		listener->active.store(false, std::memory_order_release);
+		ReleaseSlot(listener->handle);
+		m_count.fetch_sub(1, std::memory_order_relaxed);
+
+		const auto& listeners = *m_snapshot.load(std::memory_order_relaxed);
+		if (++m_inactive * 2 <= listeners.size()) {
+			return;
+		}
+
+		auto* copy = new std::vector<Listener*>();
+		copy->reserve(listeners.size() - m_inactive);
+		for (auto* other : listeners) {
+			if (other->active.load(std::memory_order_relaxed)) {
+				copy->push_back(other);
+			} else {
+				m_retiredListeners.push_back(other);
+			}
+		}
+		m_inactive = 0;
+		Publish(copy);
+	}
+
+	// Called with the write lock held. Old arrays and their dropped listeners are freed only once
+	// no dispatch is running, a reader that arrives after the store always loads the new array.
+	void Publish(std::vector<Listener*>* listeners) {
+		m_retired.push_back(m_snapshot.exchange(listeners, std::memory_order_seq_cst));
+		if (m_readers.load(std::memory_order_seq_cst) == 0) {
+			FreeRetired();
+		}
+	}
+
+	void FreeRetired() {
+		for (auto* retired : m_retired) {
+			delete retired;
+		}
+		for (auto* listener : m_retiredListeners) {
+			delete listener;
+		}
+		m_retired.clear();
+		m_retiredListeners.clear();
 	}
 
 private:
-	std::vector<Func> m_callables;
-};
\ No newline at end of file
+	std::atomic<const std::vector<Listener*>*> m_snapshot{new std::vector<Listener*>()};
+	mutable std::atomic<uint32_t> m_readers{};
+	std::atomic<size_t> m_count{};
+	std::vector<const std::vector<Listener*>*> m_retired;
+	std::vector<Listener*> m_retiredListeners;
+	std::vector<Listener*> m_slots;
+	std::vector<uint32_t> m_generations;
+	std::vector<size_t> m_freeSlots;
+	size_t m_inactive{};
+	std::mutex m_writeLock;
+};
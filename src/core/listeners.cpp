@@ -1,16 +1,61 @@
 #include "listeners.hpp"
 
-#define DEFINE_MANAGER_ACCESSOR(name, ret, ...)                   \
-	using Fn##name = ret (*)(__VA_ARGS__);                        \
-	ListenerManager<Fn##name>& Get##name##ListenerManager() {    \
-		static ListenerManager<Fn##name> s_##name;               \
-		return s_##name;                                          \
-	}                                                             \
-	extern "C" PLUGIN_API void name##_Register(Fn##name func) {   \
-		Get##name##ListenerManager().Register(func);              \
-	}                                                             \
-	extern "C" PLUGIN_API void name##_Unregister(Fn##name func) { \
-		Get##name##ListenerManager().Unregister(func);            \
+#include <convar.h>
+
+#include "sdk/utils.h"
+
+CConVar<bool> s2_listener_profiling("s2_listener_profiling", FCVAR_NONE, "Whether to time every listener callback, see s2_listener_stats", false,
+	[](CConVar<bool> *cvar, CSplitScreenSlot slot, const bool *new_val, const bool *old_val)
+	{
+		ListenerManagerBase::SetProfiling(*new_val);
+	});
+
+CON_COMMAND_F(s2_listener_stats, "Print the most expensive listener callbacks, pass reset to clear the counters", FCVAR_NONE) {
+	if (args.ArgC() > 1 && std::string_view(args[1]) == "reset") {
+		ListenerManagerBase::ResetAllStats();
+		return;
+	}
+
+	if (!ListenerManagerBase::IsProfiling()) {
+		S2_LOG(LS_WARNING, "Listener profiling is disabled, set s2_listener_profiling 1 first\n");
+	}
+
+	auto stats = ListenerManagerBase::CollectAllStats();
+	std::erase_if(stats, [](const ListenerStats& stat) { return stat.calls == 0; });
+	std::sort(stats.begin(), stats.end(), [](const ListenerStats& a, const ListenerStats& b) { return a.totalNs > b.totalNs; });
+
+	size_t limit = 20;
+	if (args.ArgC() > 1) {
+		limit = utils::string_to_int<size_t>(args[1]).value_or(limit);
+	}
+
+	S2_LOGF(LS_MESSAGE, "{:<40} {:>18} {:>10} {:>12} {:>12} {:>10}\n", "Listener", "Callback", "Calls", "Total ms", "Avg us", "Max us");
+	for (size_t i = 0; i < std::min(limit, stats.size()); ++i) {
+		const auto& stat = stats[i];
+		std::string_view name = stat.manager.empty() ? "<unnamed>" : stat.manager.view();
+		S2_LOGF(LS_MESSAGE, "{:<40} {:>#18x} {:>10} {:>12.3f} {:>12.3f} {:>10.3f}\n",
+				name, stat.callback, stat.calls,
+				static_cast<double>(stat.totalNs) / 1e6, static_cast<double>(stat.totalNs) / static_cast<double>(stat.calls) / 1e3, static_cast<double>(stat.maxNs) / 1e3);
+	}
+}
+
+#define DEFINE_MANAGER_ACCESSOR(name, ret, ...)                                               \
+	using Fn##name = ret (*)(__VA_ARGS__);                                                    \
+	ListenerManager<Fn##name>& Get##name##ListenerManager() {                                 \
+		static ListenerManager<Fn##name> s_##name(#name);                                     \
+		return s_##name;                                                                      \
+	}                                                                                         \
+	extern "C" PLUGIN_API void name##_Register(Fn##name func) {                               \
+		Get##name##ListenerManager().Register(func);                                          \
+	}                                                                                         \
+	extern "C" PLUGIN_API void name##_Unregister(Fn##name func) {                             \
+		Get##name##ListenerManager().Unregister(func);                                        \
+	}                                                                                         \
+	extern "C" PLUGIN_API ListenerHandle name##_Add(Fn##name func, int priority, int group) { \
+		return Get##name##ListenerManager().Register(func, priority, group);                  \
+	}                                                                                         \
+	extern "C" PLUGIN_API bool name##_Remove(ListenerHandle handle) {                         \
+		return Get##name##ListenerManager().Unregister(handle);                               \
 	}
 
 DEFINE_MANAGER_ACCESSOR(OnClientConnect, bool, int, const plg::string&, const plg::string&)
@@ -0,0 +1,54 @@
+#pragma once
+
+// Unbounded multi-producer single-consumer queue (Vyukov).
+// Push is wait-free and can be called from any thread, Pop must only be called by the owning thread.
+template<typename T>
+class MpscQueue {
+	struct Node {
+		std::atomic<Node*> next{};
+		T value{};
+	};
+
+public:
+	MpscQueue() : m_head(new Node{}), m_tail(m_head.load(std::memory_order_relaxed)) {
+	}
+
+	~MpscQueue() {
+		while (m_tail != nullptr) {
+			Node* next = m_tail->next.load(std::memory_order_relaxed);
+			delete m_tail;
+			m_tail = next;
+		}
+	}
+
+	MpscQueue(const MpscQueue&) = delete;
+	MpscQueue& operator=(const MpscQueue&) = delete;
+
+	void Push(T value) {
+		auto* node = new Node{};
+		node->value = std::move(value);
+		Node* prev = m_head.exchange(node, std::memory_order_acq_rel);
+		prev->next.store(node, std::memory_order_release);
+	}
+
+	bool Pop(T& value) {
+		Node* tail = m_tail;
+		Node* next = tail->next.load(std::memory_order_acquire);
+		if (next == nullptr) {
+			return false;
+		}
+
+		value = std::move(next->value);
+		m_tail = next;
+		delete tail;
+		return true;
+	}
+
+	bool Empty() const {
+		return m_tail->next.load(std::memory_order_acquire) == nullptr;
+	}
+
+private:
+	std::atomic<Node*> m_head;
+	Node* m_tail;
+};
@@ -0,0 +1,46 @@
+#include "net_message_pool.hpp"
+
+CNetMessage* NetMessagePool::Acquire(INetworkMessageInternal* msgSerializable) {
+	if (!CanPool()) {
+		return msgSerializable->AllocateMessage();
+	}
+
+	auto it = m_freeMessages.find(msgSerializable);
+	if (it == m_freeMessages.end() || it->second.empty()) {
+		return msgSerializable->AllocateMessage();
+	}
+
+	CNetMessage* message = it->second.back();
+	it->second.pop_back();
+	return message;
+}
+
+void NetMessagePool::Release(INetworkMessageInternal* msgSerializable, CNetMessage* message) {
+	if (!CanPool()) {
+		delete message;
+		return;
+	}
+
+	auto& messages = m_freeMessages[msgSerializable];
+	if (messages.size() >= MAX_FREE_MESSAGES) {
+		delete message;
+		return;
+	}
+
+	const_cast<google::protobuf::Message*>(message->AsMessage())->Clear();
+	messages.push_back(message);
+}
+
+void NetMessagePool::Clear() {
+	// Messages still held by plugins are deleted on release from now on, nothing refills the pool
+	m_closed = true;
+
+	for (const auto& [_, messages] : m_freeMessages) {
+		for (CNetMessage* message : messages) {
+			delete message;
+		}
+	}
+	m_freeMessages.clear();
+}
+
+NetMessagePool g_NetMessagePool;
\ No newline at end of file
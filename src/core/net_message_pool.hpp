@@ -0,0 +1,35 @@
+#pragma once
+
+#include <networksystem/netmessage.h>
+
+#include <thread>
+
+// Free lists of cleared messages per message type, filled and drained on the main thread only.
+// Clear keeps string and repeated field capacity, so a reused message fills without allocating.
+// Other threads and releases after Clear fall back to plain allocation, as without the pool.
+class NetMessagePool {
+public:
+	static constexpr size_t MAX_FREE_MESSAGES = 16;
+
+	NetMessagePool() = default;
+	~NetMessagePool() = default;
+
+	CNetMessage* Acquire(INetworkMessageInternal* msgSerializable);
+	void Release(INetworkMessageInternal* msgSerializable, CNetMessage* message);
+	void Clear();
+
+	template<typename T>
+	T* Acquire(INetworkMessageInternal* msgSerializable) {
+		return Acquire(msgSerializable)->As<T>();
+	}
+
+private:
+	bool CanPool() const { return !m_closed && std::this_thread::get_id() == m_mainThreadId; }
+
+private:
+	std::unordered_map<INetworkMessageInternal*, std::vector<CNetMessage*>> m_freeMessages;
+	std::thread::id m_mainThreadId{std::this_thread::get_id()};
+	bool m_closed{};
+};
+
+extern NetMessagePool g_NetMessagePool;
\ No newline at end of file
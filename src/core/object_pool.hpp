@@ -0,0 +1,47 @@
+#pragma once
+
+// Slab allocator for fixed type objects, not thread-safe.
+// Objects are constructed once per slab and recycled as is, so members
+// such as vectors keep their capacity between uses. Callers reset state themselves.
+template<typename T, size_t SlabSize = 256>
+class ObjectPool {
+public:
+	ObjectPool() = default;
+	ObjectPool(const ObjectPool&) = delete;
+	ObjectPool& operator=(const ObjectPool&) = delete;
+
+	T* Acquire() {
+		if (m_free.empty()) {
+			Grow();
+		}
+
+		T* object = m_free.back();
+		m_free.pop_back();
+		return object;
+	}
+
+	void Release(T* object) {
+		m_free.push_back(object);
+	}
+
+	size_t GetCapacity() const {
+		return m_slabs.size() * SlabSize;
+	}
+
+	size_t GetFree() const {
+		return m_free.size();
+	}
+
+private:
+	void Grow() {
+		auto& slab = m_slabs.emplace_back(std::make_unique<T[]>(SlabSize));
+		m_free.reserve(GetCapacity());
+		for (size_t i = SlabSize; i-- > 0;) {
+			m_free.push_back(&slab[i]);
+		}
+	}
+
+private:
+	std::vector<std::unique_ptr<T[]>> m_slabs;
+	std::vector<T*> m_free;
+};
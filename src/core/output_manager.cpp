@@ -6,7 +6,9 @@ bool EntityOutputManager::HookEntityOutput(plg::string classname, plg::string ou
 
 	auto it = m_hookMap.find(outputKey);
 	if (it == m_hookMap.end()) {
-		auto& callbackPair = m_hookMap.emplace(std::move(outputKey), CallbackPair{}).first->second;
+		auto& [key, callbackPair] = *m_hookMap.try_emplace(std::move(outputKey)).first;
+		callbackPair.callbacks[static_cast<size_t>(HookMode::Pre)].SetName(std::format("output:{}:{}:pre", key.first, key.second));
+		callbackPair.callbacks[static_cast<size_t>(HookMode::Post)].SetName(std::format("output:{}:{}:post", key.first, key.second));
 		return callbackPair.callbacks[static_cast<size_t>(mode)].Register(callback);
 	} else {
 		auto& callbackPair = std::get<CallbackPair>(*it);
@@ -60,8 +62,9 @@ ResultType EntityOutputManager::FireOutputInternal(CEntityIOOutput* pThis, CEnti
 
 	for (const auto& pCallbackPair: m_vecCallbackPairs) {
 		auto& cb = pCallbackPair->callbacks[0];
-		for (size_t i = 0; i < cb.GetCount(); ++i) {
-			auto thisResult = cb.Notify(i, activator, caller, flDelay);
+		const auto snapshot = cb.GetSnapshot();
+		for (const auto& listener : snapshot) {
+			auto thisResult = snapshot.Notify(listener, activator, caller, flDelay);
 			if (thisResult >= ResultType::Stop) {
 				break;
 			}
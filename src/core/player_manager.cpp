@@ -1,5 +1,6 @@
 #include "player_manager.hpp"
 #include "listeners.hpp"
+#include "timer_system.hpp"
 
 #include <core/sdk/entity/cbaseplayercontroller.h>
 #include <core/sdk/entity/cplayercontroller.h>
@@ -160,8 +161,9 @@ bool PlayerManager::OnClientConnect(CPlayerSlot slot, const char* name, uint64 s
 
 		s_refuseConnection = false;
 
-		for (size_t i = 0; i < GetOnClientConnectListenerManager().GetCount(); ++i) {
-			s_refuseConnection |= !GetOnClientConnectListenerManager().Notify(i, slot, name, networkID);
+		const auto snapshot = GetOnClientConnectListenerManager().GetSnapshot();
+		for (const auto& listener : snapshot) {
+			s_refuseConnection |= !snapshot.Notify(listener, slot, name, networkID);
 		}
 
 		return s_refuseConnection;
@@ -209,6 +211,7 @@ void PlayerManager::OnClientDisconnect(CPlayerSlot slot, ENetworkDisconnectionRe
 
 void PlayerManager::OnClientDisconnect_Post(CPlayerSlot slot, ENetworkDisconnectionReason reason) {
 	GetOnClientDisconnect_PostListenerManager().Notify(slot, reason);
+	g_TimerSystem.OnClientDisconnect(slot);
 
 	Player* player = ToPlayer(slot);
 	if (player) {
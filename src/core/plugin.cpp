@@ -10,17 +10,21 @@
 #include "core_config.hpp"
 #include "con_command_manager.hpp"
 #include "con_var_manager.hpp"
+#include "coroutine_scheduler.hpp"
 #include "event_listener.hpp"
 #include "event_manager.hpp"
+#include "frame_scheduler.hpp"
 #include "hook_holder.hpp"
 #include "listeners.hpp"
 #include "multi_addon_manager.hpp"
+#include "net_message_pool.hpp"
 #include "output_manager.hpp"
 #include "panorama_vote.hpp"
 #include "player_manager.hpp"
 #include "server_manager.hpp"
 #include "timer_system.hpp"
 #include "user_message_manager.hpp"
+#include "worker_pool.hpp"
 
 #include <core/sdk/entity/cgamerules.h>
 
@@ -72,6 +76,30 @@ void Source2SDK::OnPluginStart() {
 		{ "data", plg::GetDataDir() },
 	});
 
+	// Core work keeps its historical order, plugin work registered later runs after it
+	g_FrameScheduler.AddWork(FramePhase::GameFrame, [](uint32_t, bool, const plg::vector<plg::any>&) {
+		g_MultiAddonManager.OnGameFrame();
+	}, FramePriority::Critical);
+	g_FrameScheduler.AddWork(FramePhase::GameFrame, [](uint32_t, bool, const plg::vector<plg::any>&) {
+		g_ServerManager.OnGameFrame();
+	}, FramePriority::Critical);
+	g_FrameScheduler.AddWork(FramePhase::GameFrame, [](uint32_t, bool simulating, const plg::vector<plg::any>&) {
+		g_TimerSystem.OnGameFrame(simulating);
+	}, FramePriority::Critical);
+	g_FrameScheduler.AddWork(FramePhase::GameFrame, [](uint32_t, bool, const plg::vector<plg::any>&) {
+		const auto& context = g_FrameScheduler.GetContext();
+		GetOnGameFrameListenerManager().Notify(context.simulating, context.firstTick, context.lastTick);
+	}, FramePriority::Critical);
+	g_FrameScheduler.AddWork(FramePhase::GameFrame, [](uint32_t, bool, const plg::vector<plg::any>&) {
+		g_EventManager.FlushEventStreams();
+	}, FramePriority::Critical);
+	g_FrameScheduler.AddWork(FramePhase::PreWorldUpdate, [](uint32_t, bool, const plg::vector<plg::any>&) {
+		g_ServerManager.OnPreWorldUpdate();
+	}, FramePriority::Critical);
+	g_FrameScheduler.AddWork(FramePhase::PreWorldUpdate, [](uint32_t, bool simulating, const plg::vector<plg::any>&) {
+		GetOnPreWorldUpdateListenerManager().Notify(simulating);
+	}, FramePriority::Critical);
+
 	using enum poly::CallbackType;
 
 	g_PH.AddHookMemFunc(&IGameEventManager2::FireEvent, g_pGameEventManager, Hook_FireEvent, Pre, Post);
@@ -121,9 +149,12 @@ void Source2SDK::OnPluginStart() {
 }
 
 void Source2SDK::OnPluginEnd() {
+	g_WorkerPool.Stop();
 	globals::Terminate();
 	g_PH.UnhookAll();
 	UnregisterEventListeners();
+	g_CoroutineScheduler.Clear();
+	g_NetMessagePool.Clear();
 
 	S2_LOG(LS_DEBUG, "[OnPluginEnd] = Source2SDK!\n");
 }
@@ -157,6 +188,8 @@ void Source2SDK::OnServerStartup() {
 	g_MultiAddonManager.OnStartupServer();
 
 	RegisterEventListeners();
+
+	g_EventManager.RebuildEventIndex();
 }
 
 poly::ReturnAction Source2SDK::Hook_StartupServer(poly::IHook& hook, poly::Params& params, int count, poly::Return& ret, poly::CallbackType type) {
@@ -261,11 +294,7 @@ poly::ReturnAction Source2SDK::Hook_GameFrame(poly::IHook& hook, poly::Params& p
 	auto bFirstTick = poly::GetArgument<bool>(params, 2);
 	auto bLastTick = poly::GetArgument<bool>(params, 3);
 
-	g_MultiAddonManager.OnGameFrame();
-	g_ServerManager.OnGameFrame();
-	g_TimerSystem.OnGameFrame(simulating);
-
-	GetOnGameFrameListenerManager().Notify(simulating, bFirstTick, bLastTick);
+	g_FrameScheduler.Run(FramePhase::GameFrame, {simulating, bFirstTick, bLastTick});
 	return poly::ReturnAction::Ignored;
 }
 
@@ -435,9 +464,7 @@ poly::ReturnAction Source2SDK::Hook_PreWorldUpdate(poly::IHook& hook, poly::Para
 	auto simulating = poly::GetArgument<bool>(params, 1);
 	//S2_LOGF(LS_DEBUG, "PreWorldUpdate = {}\n", simulating);
 
-	g_ServerManager.OnPreWorldUpdate();
-
-	GetOnPreWorldUpdateListenerManager().Notify(simulating);
+	g_FrameScheduler.Run(FramePhase::PreWorldUpdate, {simulating, false, false});
 	return poly::ReturnAction::Ignored;
 }
 
@@ -574,6 +601,7 @@ poly::ReturnAction Source2SDK::Hook_OnRemoveEntity(poly::IHook& hook, poly::Para
 		g_pGameRules = nullptr;
 	}
 	GetOnEntityDeletedListenerManager().Notify(handle.ToInt());
+	g_TimerSystem.OnEntityDeleted(handle.ToInt());
 	return poly::ReturnAction::Ignored;
 }
 
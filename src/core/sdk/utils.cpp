@@ -13,6 +13,7 @@
 #include "entity/cplayercontroller.h"
 #include "entity/globaltypes.h"
 #include "core/player_manager.hpp"
+#include "core/net_message_pool.hpp"
 
 #include <tier0/memdbgon.h>
 
@@ -203,19 +204,19 @@ void utils::ReplicateConVar(const ConVarRefAbstract& conVar, const char* value)
 
 void utils::SendConVarValue(CPlayerSlot slot, const char* name, const char* value) {
 	static INetworkMessageInternal* pNetMsg = g_pNetworkMessages->FindNetworkMessagePartial("CNETMsg_SetConVar");
-	auto data = pNetMsg->AllocateMessage()->As<CNETMsg_SetConVar_t>();
+	auto data = g_NetMessagePool.Acquire<CNETMsg_SetConVar_t>(pNetMsg);
 	CMsg_CVars_CVar* cvar = data->mutable_convars()->add_cvars();
 	cvar->set_name(name);
 	cvar->set_value(value);
 
 	CSingleRecipientFilter filter(slot);
 	g_pGameEventSystem->PostEventAbstract(-1, false, &filter, pNetMsg, data, 0);
-	delete data;
+	g_NetMessagePool.Release(pNetMsg, data);
 }
 
 void utils::SendMultipleConVarValues(CPlayerSlot slot, const char** names, const char** value, uint32_t size) {
 	static INetworkMessageInternal* pNetMsg = g_pNetworkMessages->FindNetworkMessagePartial("CNETMsg_SetConVar");
-	auto data = pNetMsg->AllocateMessage()->As<CNETMsg_SetConVar_t>();
+	auto data = g_NetMessagePool.Acquire<CNETMsg_SetConVar_t>(pNetMsg);
 	for (uint32_t i = 0; i < size; ++i) {
 		CMsg_CVars_CVar* cvar = data->mutable_convars()->add_cvars();
 		cvar->set_name(names[i]);
@@ -223,7 +224,7 @@ void utils::SendMultipleConVarValues(CPlayerSlot slot, const char** names, const
 	}
 	CSingleRecipientFilter filter(slot);
 	g_pGameEventSystem->PostEventAbstract(-1, false, &filter, pNetMsg, data, 0);
-	delete data;
+	g_NetMessagePool.Release(pNetMsg, data);
 }
 
 bool utils::IsSpawnValid(const Vector& origin) {
@@ -1,6 +1,7 @@
 #include "utils.h"
 
 #include "entity/globaltypes.h"
+#include "core/net_message_pool.hpp"
 #include <recipientfilter.h>
 #include <engine/igameeventsystem.h>
 #include <igameevents.h>
@@ -182,14 +183,14 @@ bool utils::CFormat(char* buffer, uint64_t buffer_size, const char* text) {
 }
 
 void utils::ClientPrintFilter(IRecipientFilter* filter, int msg_dest, const char* msg_name) {
-	INetworkMessageInternal* pNetMsg = g_pNetworkMessages->FindNetworkMessagePartial("TextMsg");
-	auto* data = pNetMsg->AllocateMessage()->As<CUserMessageTextMsg_t>();
+	static INetworkMessageInternal* pNetMsg = g_pNetworkMessages->FindNetworkMessagePartial("TextMsg");
+	auto* data = g_NetMessagePool.Acquire<CUserMessageTextMsg_t>(pNetMsg);
 
 	data->set_dest(msg_dest);
 	data->add_param(msg_name);
 
 	g_pGameEventSystem->PostEventAbstract(-1, false, filter, pNetMsg, data, 0);
-	delete data;
+	g_NetMessagePool.Release(pNetMsg, data);
 }
 
 void utils::PrintConsole(CPlayerSlot slot, const char* message) {
@@ -3,43 +3,61 @@
 #include <edict.h>
 
 void ServerManager::OnGameFrame() {
-	if (m_nextTasks.empty())
-		return;
-
-	std::lock_guard<std::mutex> lock(m_nextTasksLock);
+	//S2_LOGF(LS_DEBUG, "Executing queued tasks of size: {} on tick number {}\n", m_nextTasks.pending.size(), gpGlobals->tickcount);
 
-	//S2_LOGF(LS_DEBUG, "Executing queued tasks of size: {} on tick number {}\n", m_nextTasks.size(), gpGlobals->tickcount);
+	RunTasks(m_nextTasks);
+}
 
-	for (const auto& [nextTask, userData]: m_nextTasks) {
-		nextTask(userData);
-	}
+void ServerManager::OnPreWorldUpdate() {
+	//S2_LOGF(LS_DEBUG, "Executing queued tasks of size: {} at time {}\n", m_nextWorldUpdateTasks.pending.size(), gpGlobals->curtime);
 
-	m_nextTasks.clear();
+	RunTasks(m_nextWorldUpdateTasks);
 }
 
-void ServerManager::OnPreWorldUpdate() {
-	if (m_nextWorldUpdateTasks.empty())
+void ServerManager::RunTasks(TaskQueue& queue) {
+	Task remote;
+	while (queue.remote.Pop(remote)) {
+		Task* task = queue.pool.Acquire();
+		task->callback = remote.callback;
+		task->userData = remote.userData;
+		queue.pending.push_back(task);
+	}
+
+	if (queue.pending.empty())
 		return;
 
-	std::lock_guard<std::mutex> lock(m_nextWorldUpdateTasksLock);
+	std::swap(queue.pending, queue.running);
+
+	for (auto* task : queue.running) {
+		task->callback(task->userData);
+	}
 
-	//S2_LOGF(LS_DEBUG, "Executing queued tasks of size: {} at time {}\n", m_nextWorldUpdateTasks.size(), gpGlobals->curtime);
+	for (auto* task : queue.running) {
+		task->userData.clear();
+		queue.pool.Release(task);
+	}
 
-	for (const auto& [nextTask, userData]: m_nextWorldUpdateTasks) {
-		nextTask(userData);
+	queue.running.clear();
+}
+
+void ServerManager::QueueTask(TaskQueue& queue, TaskCallback callback, const plg::vector<plg::any>& userData) {
+	if (!IsMainThread()) {
+		queue.remote.Push({callback, userData});
+		return;
 	}
 
-	m_nextWorldUpdateTasks.clear();
+	Task* task = queue.pool.Acquire();
+	task->callback = callback;
+	task->userData = userData;
+	queue.pending.push_back(task);
 }
 
 void ServerManager::AddTaskForNextFrame(TaskCallback task, const plg::vector<plg::any>& userData) {
-	std::lock_guard<std::mutex> lock(m_nextTasksLock);
-	m_nextTasks.emplace_back(task, userData);
+	QueueTask(m_nextTasks, task, userData);
 }
 
 void ServerManager::AddTaskForNextWorldUpdate(TaskCallback task, const plg::vector<plg::any>& userData) {
-	std::lock_guard<std::mutex> lock(m_nextWorldUpdateTasksLock);
-	m_nextWorldUpdateTasks.emplace_back(task, userData);
+	QueueTask(m_nextWorldUpdateTasks, task, userData);
 }
 
 ServerManager g_ServerManager;
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
-#include <mutex>
+#include "mpsc_queue.hpp"
+#include "object_pool.hpp"
+
 #include <thread>
 
 using TaskCallback = void (*)(const plg::vector<plg::any>&);
@@ -15,14 +17,28 @@ public:
 
 private:
 	struct Task {
-		TaskCallback callback;
+		TaskCallback callback{};
 		plg::vector<plg::any> userData;
 	};
 
-	std::vector<Task> m_nextWorldUpdateTasks;
-	std::vector<Task> m_nextTasks;
-	std::mutex m_nextWorldUpdateTasksLock;
-	std::mutex m_nextTasksLock;
+	// Main thread tasks go to the pending buffer, which is swapped with the running one before a drain,
+	// so tasks can queue follow-up tasks. Other threads push to the lock-free queue instead.
+	// Tasks are recycled through the pool, so their user data keeps its capacity between frames.
+	struct TaskQueue {
+		ObjectPool<Task> pool;
+		std::vector<Task*> pending;
+		std::vector<Task*> running;
+		MpscQueue<Task> remote;
+	};
+
+	void QueueTask(TaskQueue& queue, TaskCallback callback, const plg::vector<plg::any>& userData);
+	static void RunTasks(TaskQueue& queue);
+
+	bool IsMainThread() const { return std::this_thread::get_id() == m_mainThreadId; }
+
+	TaskQueue m_nextWorldUpdateTasks;
+	TaskQueue m_nextTasks;
+	std::thread::id m_mainThreadId{std::this_thread::get_id()};
 };
 
 extern ServerManager g_ServerManager;
\ No newline at end of file
@@ -1,7 +1,10 @@
 #include "timer_system.hpp"
 
+#include <convar.h>
 #include <edict.h>
 
+CConVar<double> s2_timer_frame_budget("s2_timer_frame_budget", FCVAR_NONE, "Maximum time in milliseconds spent in timer callbacks per frame, due timers past the budget run on the next frame. Pass 0 for no limit.", 0.0);
+
 double universalTime = 0.0f;
 double timerNextThink = 0.0f;
 const double engineFixedTickInterval = 0.015625;
@@ -13,6 +16,14 @@ void TimerSystem::OnChangeLevel() {
 	m_hasMapTicked = false;
 }
 
+void TimerSystem::OnEntityDeleted(int entityHandle) {
+	KillOwnerTimers(MakeOwner(TimerOwnerType::Entity, entityHandle));
+}
+
+void TimerSystem::OnClientDisconnect(int playerSlot) {
+	KillOwnerTimers(MakeOwner(TimerOwnerType::Player, playerSlot));
+}
+
 void TimerSystem::OnGameFrame(bool simulating) {
 	if (simulating && m_hasMapTicked) {
 		universalTime += gpGlobals->curtime - m_lastTickedTime;
@@ -24,9 +35,17 @@ void TimerSystem::OnGameFrame(bool simulating) {
 	m_lastTickedTime = gpGlobals->curtime;
 	m_hasMapTicked = true;
 
+	// tickcount restarts on map change, count it as a single tick
+	int tickCount = gpGlobals->tickcount;
+	if (tickCount != m_lastTickCount) {
+		m_tickedCount += tickCount > m_lastTickCount ? static_cast<uint64_t>(tickCount - m_lastTickCount) : 1;
+		m_lastTickCount = tickCount;
+	}
+
 	// Handle timer tick
-	if (universalTime >= timerNextThink) {
-		RunFrame();
+	bool think = universalTime >= timerNextThink;
+	RunFrame(think);
+	if (think) {
 		timerNextThink = CalculateNextThink(timerNextThink, 0.1);
 	}
 }
@@ -39,82 +58,270 @@ double TimerSystem::CalculateNextThink(double lastThinkTime, double delay) {
 	}
 }
 
-void TimerSystem::RunFrame() {
-	while (!m_timers.empty()) {
-		auto it = m_timers.begin();
+void TimerSystem::Schedule(Timer* timer) {
+	if (timer->clock == TimerClock::Tick) {
+		// Tick timers get an estimated executeTime so they sort together with the others
+		auto ticks = static_cast<uint64_t>(std::max(std::round(timer->delay), 0.0));
+		timer->executeTime = universalTime + static_cast<double>(ticks) * engineFixedTickInterval;
+		GetWheel(TimerClock::Tick).Schedule(timer, m_tickedCount + ticks);
+	} else {
+		// Expiry is rounded up and the wheel position down, so a timer never fires before its executeTime
+		timer->executeTime = universalTime + timer->delay;
+		GetWheel(timer->clock).Schedule(timer, static_cast<uint64_t>(std::ceil(timer->executeTime / engineFixedTickInterval)));
+	}
+}
 
-		if (universalTime >= it->executeTime) {
-			it->exec = true;
-			it->callback(it->id, it->userData);
-			it->exec = false;
+void TimerSystem::ProcessCommands() {
+	TimerCommand command;
+	while (m_commands.Pop(command)) {
+		switch (command.type) {
+			case TimerCommandType::Create:
+				AddTimer(command.id, command.delay, command.callback, command.flags, command.userData, command.owner);
+				break;
+			case TimerCommandType::Kill:
+				RemoveTimer(command.id);
+				break;
+			case TimerCommandType::KillOwner:
+				RemoveOwnerTimers(command.owner);
+				break;
+			case TimerCommandType::Reschedule:
+				UpdateTimer(command.id, command.delay);
+				break;
+		}
+	}
+}
 
-			if (it->repeat && !it->kill) {
-				auto node = m_timers.extract(it);
-				node.value().executeTime = universalTime + node.value().delay;
-				m_timers.insert(std::move(node));
-				continue;
-			}
+void TimerSystem::RunFrame(bool think) {
+	ProcessCommands();
+
+	auto currentTick = static_cast<uint64_t>(universalTime / engineFixedTickInterval);
+	GetWheel(TimerClock::Time).Advance(currentTick, m_expired);
+	GetWheel(TimerClock::Tick).Advance(m_tickedCount, m_expired);
+	if (think) {
+		GetWheel(TimerClock::Think).Advance(currentTick, m_expired);
+	}
+
+	if (m_expired.empty())
+		return;
+
+	// Timers killed or rescheduled while deferred leave an empty slot behind
+	std::erase(m_expired, nullptr);
+
+	// Keep the same dispatch order as before: by execute time, then by creation.
+	// Timers deferred from the previous frame are still in the list and sort first.
+	std::sort(m_expired.begin(), m_expired.end(), [](const TimerWheelNode* lhs, const TimerWheelNode* rhs) {
+		return *static_cast<const Timer*>(lhs) < *static_cast<const Timer*>(rhs);
+	});
+
+	using namespace std::chrono;
+	const auto budget = duration_cast<steady_clock::duration>(duration<double, std::milli>(s2_timer_frame_budget.Get()));
+	const auto start = steady_clock::now();
 
-			m_timers.erase(it); // Only erase non-repeating tasks
+	size_t i = 0;
+	while (i < m_expired.size()) {
+		auto* timer = static_cast<Timer*>(m_expired[i++]);
+		if (timer == nullptr)
+			continue;
+
+		timer->exec = true;
+		timer->deferred = false;
+
+		timer->callback(timer->id, timer->userData);
+
+		timer->exec = false;
+
+		if (timer->repeat && !timer->kill) {
+			Schedule(timer);
 		} else {
+			FreeTimer(timer); // Only erase non-repeating tasks
+		}
+
+		// Past the cap the budget is ignored, so a budget that is always exceeded cannot grow the backlog forever
+		if (budget.count() > 0 && m_expired.size() - i <= MAX_DEFERRED_TIMERS && steady_clock::now() - start >= budget) {
+			++m_budgetOverruns;
 			break;
 		}
 	}
+
+	m_expired.erase(m_expired.begin(), m_expired.begin() + static_cast<ptrdiff_t>(i));
+
+	for (auto* node : m_expired) {
+		auto* timer = static_cast<Timer*>(node);
+		if (timer != nullptr && !timer->deferred) {
+			timer->deferred = true;
+			++m_deferredTimers;
+		}
+	}
 }
 
 void TimerSystem::RemoveMapChangeTimers() {
-	std::lock_guard<std::mutex> lock(m_createTimerLock);
+	ProcessCommands();
 
 	for (auto it = m_timers.begin(); it != m_timers.end();) {
-		if (it->noMapChange) {
-			it = m_timers.erase(it);
-		} else {
-			++it;
+		auto* timer = it->second;
+		++it;
+		if (timer->noMapChange) {
+			DestroyTimer(timer);
 		}
 	}
 }
 
-uint32_t TimerSystem::CreateTimer(double delay, TimerCallback callback, TimerFlag flags, const plg::vector<plg::any>& userData) {
-	std::lock_guard<std::mutex> lock(m_createTimerLock);
-
+uint32_t TimerSystem::CreateTimer(double delay, TimerCallback callback, TimerFlag flags, const plg::vector<plg::any>& userData, uint64_t owner) {
 	uint32_t id = ++s_nextId;
-	m_timers.emplace(id, flags & Repeat, flags & NoMapChange, false, false, universalTime + delay, delay, callback, userData);
+
+	// Off-thread callers never touch the wheels, the command is applied at the start of the next RunFrame
+	if (IsMainThread()) {
+		AddTimer(id, delay, callback, flags, userData, owner);
+	} else {
+		m_commands.Push({TimerCommandType::Create, id, delay, flags, callback, userData, owner});
+	}
+
 	return id;
 }
 
 void TimerSystem::KillTimer(uint32_t id) {
-	std::lock_guard<std::mutex> lock(m_createTimerLock);
+	if (IsMainThread()) {
+		// A create queued from another thread must land first, otherwise the kill finds nothing
+		ProcessCommands();
+		RemoveTimer(id);
+	} else {
+		m_commands.Push({TimerCommandType::Kill, id});
+	}
+}
 
-	auto it = std::find_if(m_timers.begin(), m_timers.end(), [id](const Timer& timer) {
-		return timer.id == id;
-	});
+void TimerSystem::KillOwnerTimers(uint64_t owner) {
+	if (IsMainThread()) {
+		ProcessCommands();
+		RemoveOwnerTimers(owner);
+	} else {
+		m_commands.Push({.type = TimerCommandType::KillOwner, .owner = owner});
+	}
+}
 
+void TimerSystem::RescheduleTimer(uint32_t id, double newDelay) {
+	if (IsMainThread()) {
+		ProcessCommands();
+		UpdateTimer(id, newDelay);
+	} else {
+		m_commands.Push({TimerCommandType::Reschedule, id, newDelay});
+	}
+}
+
+void TimerSystem::AddTimer(uint32_t id, double delay, TimerCallback callback, TimerFlag flags, const plg::vector<plg::any>& userData, uint64_t owner) {
+	Timer* timer = m_timerPool.Acquire();
+	timer->id = id;
+	timer->repeat = flags & Repeat;
+	timer->noMapChange = flags & NoMapChange;
+	timer->clock = (flags & Ticks) ? TimerClock::Tick : (flags & Coarse) ? TimerClock::Think : TimerClock::Time;
+	timer->exec = false;
+	timer->kill = false;
+	timer->deferred = false;
+	timer->delay = delay;
+	timer->callback = callback;
+	timer->userData = userData; // reuses the capacity left by the previous owner of this node
+	timer->owner = owner;
+	timer->ownerNext = nullptr;
+	timer->ownerPprev = nullptr;
+
+	if (owner != 0) {
+		Timer*& head = m_ownerTimers[owner];
+		timer->ownerNext = head;
+		timer->ownerPprev = &head;
+		if (head != nullptr) {
+			head->ownerPprev = &timer->ownerNext;
+		}
+		head = timer;
+	}
+
+	Schedule(timer);
+
+	if (m_freeNodes.empty()) {
+		m_timers.emplace(id, timer);
+	} else {
+		auto node = std::move(m_freeNodes.back());
+		m_freeNodes.pop_back();
+		node.key() = id;
+		node.mapped() = timer;
+		m_timers.insert(std::move(node));
+	}
+}
+
+void TimerSystem::RemoveTimer(uint32_t id) {
+	auto it = m_timers.find(id);
 	if (it != m_timers.end()) {
-		if (it->exec) {
-			it->kill = true;
+		DestroyTimer(it->second);
+	}
+}
+
+void TimerSystem::DestroyTimer(Timer* timer) {
+	if (timer->exec) {
+		timer->kill = true;
+	} else {
+		if (timer->IsScheduled()) {
+			GetWheel(timer->clock).Cancel(timer);
 		} else {
-			m_timers.erase(it);
+			DropExpired(timer);
 		}
+		FreeTimer(timer);
 	}
 }
 
-void TimerSystem::RescheduleTimer(uint32_t id, double newDelay) {
-	std::lock_guard<std::mutex> lock(m_createTimerLock);
+void TimerSystem::DropExpired(Timer* timer) {
+	// The slot is cleared instead of erased, RunFrame may be walking the list right now
+	auto it = std::find(m_expired.begin(), m_expired.end(), timer);
+	if (it != m_expired.end()) {
+		*it = nullptr;
+	}
+}
 
-	auto it = std::find_if(m_timers.begin(), m_timers.end(), [id](const Timer& timer) {
-		return timer.id == id;
-	});
+void TimerSystem::RemoveOwnerTimers(uint64_t owner) {
+	auto it = m_ownerTimers.find(owner);
+	if (it == m_ownerTimers.end())
+		return;
 
-	if (it != m_timers.end()) {
-		if (!it->exec) {
-			auto node = m_timers.extract(it);
-			node.value().delay = newDelay;
-			node.value().executeTime = universalTime + newDelay;
-			m_timers.insert(std::move(node));
+	// FreeTimer drops the owner entry together with the last timer, do not touch it afterwards
+	Timer* timer = it->second;
+	while (timer != nullptr) {
+		Timer* next = timer->ownerNext;
+		RemoveTimer(timer->id);
+		timer = next;
+	}
+}
+
+void TimerSystem::FreeTimer(Timer* timer) {
+	if (timer->ownerPprev != nullptr) {
+		*timer->ownerPprev = timer->ownerNext;
+		if (timer->ownerNext != nullptr) {
+			timer->ownerNext->ownerPprev = timer->ownerPprev;
+		}
+
+		auto it = m_ownerTimers.find(timer->owner);
+		if (it->second == nullptr) {
+			m_ownerTimers.erase(it);
 		}
 	}
+
+	m_freeNodes.push_back(m_timers.extract(timer->id));
+	timer->userData.clear();
+	m_timerPool.Release(timer);
 }
 
+void TimerSystem::UpdateTimer(uint32_t id, double newDelay) {
+	auto it = m_timers.find(id);
+	if (it != m_timers.end()) {
+		auto* timer = it->second;
+		if (!timer->exec) {
+			if (timer->IsScheduled()) {
+				GetWheel(timer->clock).Cancel(timer);
+			} else {
+				DropExpired(timer);
+				timer->deferred = false;
+			}
+			timer->delay = newDelay;
+			Schedule(timer);
+		}
+	}
+}
 
 double TimerSystem::GetTickedTime() {
 	return universalTime;
@@ -124,4 +331,12 @@ double TimerSystem::GetTickedInterval() {
 	return engineFixedTickInterval;
 }
 
+uint64_t TimerSystem::GetDeferredTimers() const {
+	return m_deferredTimers;
+}
+
+uint64_t TimerSystem::GetBudgetOverruns() const {
+	return m_budgetOverruns;
+}
+
 TimerSystem g_TimerSystem;
\ No newline at end of file
@@ -1,25 +1,51 @@
 #pragma once
 
+#include "mpsc_queue.hpp"
+#include "object_pool.hpp"
+#include "timer_wheel.hpp"
+
+#include <thread>
+
 enum TimerFlag : int {
 	Default = 0,
 
 	Repeat = (1 << 0),
-	NoMapChange = (1 << 1)
+	NoMapChange = (1 << 1),
+	Ticks = (1 << 2),
+	Coarse = (1 << 3)
+};
+
+enum class TimerClock : uint8_t {
+	Time,   // delay in seconds, dispatched every tick
+	Tick,   // delay in whole server ticks
+	Think,  // delay in seconds, dispatched on the 0.1 second think
+	Count
+};
+
+enum class TimerOwnerType : uint8_t {
+	None,
+	Entity, // entity handle, timers are killed when the entity is removed
+	Player, // player slot, timers are killed when the client disconnects
 };
 
 using TimerCallback = void (*)(uint32_t, const plg::vector<plg::any>&);
 
-struct Timer {
+struct Timer : TimerWheelNode {
 	uint32_t id;
 	bool repeat;
 	bool noMapChange;
-	mutable bool exec;
-	mutable bool kill;
+	TimerClock clock;
+	bool exec;
+	bool kill;
+	bool deferred;
 	//double createTime;
 	double executeTime;
 	double delay;
 	TimerCallback callback;
 	plg::vector<plg::any> userData;
+	uint64_t owner;
+	Timer* ownerNext;
+	Timer** ownerPprev;
 
 	bool operator<(const Timer& other) const {
 		return executeTime < other.executeTime ||
@@ -27,28 +53,82 @@ struct Timer {
 	}
 };
 
+enum class TimerCommandType : uint8_t {
+	Create,
+	Kill,
+	KillOwner,
+	Reschedule,
+};
+
+struct TimerCommand {
+	TimerCommandType type{};
+	uint32_t id{};
+	double delay{};
+	TimerFlag flags{};
+	TimerCallback callback{};
+	plg::vector<plg::any> userData;
+	uint64_t owner{};
+};
+
 class TimerSystem {
 public:
+	// Due timers kept for the next frame when the budget runs out, past this they run regardless
+	static constexpr size_t MAX_DEFERRED_TIMERS = 4096;
+
 	void OnChangeLevel();
 	void OnGameFrame(bool simulating);
+	void OnEntityDeleted(int entityHandle);
+	void OnClientDisconnect(int playerSlot);
 
-	void RunFrame();
+	void RunFrame(bool think);
 	void RemoveMapChangeTimers();
 	static double CalculateNextThink(double lastThinkTime, double delay);
 	static double GetTickedTime();
 	static double GetTickedInterval();
+	uint64_t GetDeferredTimers() const;
+	uint64_t GetBudgetOverruns() const;
 
-	uint32_t CreateTimer(double delay, TimerCallback callback, TimerFlag flags = Default, const plg::vector<plg::any>& userData = {});
+	uint32_t CreateTimer(double delay, TimerCallback callback, TimerFlag flags = Default, const plg::vector<plg::any>& userData = {}, uint64_t owner = 0);
 	void KillTimer(uint32_t id);
+	void KillOwnerTimers(uint64_t owner);
+
+	static uint64_t MakeOwner(TimerOwnerType type, int value) {
+		return (static_cast<uint64_t>(type) << 32) | static_cast<uint32_t>(value);
+	}
 	void RescheduleTimer(uint32_t id, double newDelay);
 
+private:
+	void Schedule(Timer* timer);
+	void ProcessCommands();
+	void AddTimer(uint32_t id, double delay, TimerCallback callback, TimerFlag flags, const plg::vector<plg::any>& userData, uint64_t owner);
+	void RemoveTimer(uint32_t id);
+	void DestroyTimer(Timer* timer);
+	void DropExpired(Timer* timer);
+	void RemoveOwnerTimers(uint64_t owner);
+	void FreeTimer(Timer* timer);
+	void UpdateTimer(uint32_t id, double newDelay);
+	bool IsMainThread() const { return std::this_thread::get_id() == m_mainThreadId; }
+	TimerWheel& GetWheel(TimerClock clock) { return m_wheels[static_cast<size_t>(clock)]; }
+
 private:
 	bool m_hasMapTicked{};
 	bool m_hasMapSimulated{};
 	float m_lastTickedTime{};
-	std::set<Timer> m_timers;
-	std::mutex m_createTimerLock;
-	static inline uint32_t s_nextId = static_cast<uint32_t>(-1);
+	int m_lastTickCount{};
+	uint64_t m_tickedCount{};
+	uint64_t m_deferredTimers{};
+	uint64_t m_budgetOverruns{};
+	std::array<TimerWheel, static_cast<size_t>(TimerClock::Count)> m_wheels;
+	ObjectPool<Timer> m_timerPool;
+	// Index nodes are recycled through m_freeNodes, so steady timer churn never hits the heap
+	std::unordered_map<uint32_t, Timer*> m_timers;
+	std::vector<std::unordered_map<uint32_t, Timer*>::node_type> m_freeNodes;
+	// Heads of the intrusive per-owner lists
+	std::unordered_map<uint64_t, Timer*> m_ownerTimers;
+	std::vector<TimerWheelNode*> m_expired;
+	MpscQueue<TimerCommand> m_commands;
+	std::thread::id m_mainThreadId{std::this_thread::get_id()};
+	static inline std::atomic<uint32_t> s_nextId = static_cast<uint32_t>(-1);
 };
 
 extern TimerSystem g_TimerSystem;
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include "timer_wheel.hpp"
+
+void TimerWheel::Schedule(TimerWheelNode* node, uint64_t expireTick) {
+	// Current slot is already processed, so anything due now fires on the next advance
+	node->expireTick = std::max(expireTick, m_currentTick + 1);
+	Link(node);
+	++m_count;
+}
+
+void TimerWheel::Cancel(TimerWheelNode* node) {
+	if (node->IsScheduled()) {
+		Unlink(node);
+		--m_count;
+	}
+}
+
+void TimerWheel::Advance(uint64_t tick, std::vector<TimerWheelNode*>& expired) {
+	while (m_currentTick < tick) {
+		if (m_count == 0) {
+			m_currentTick = tick;
+			break;
+		}
+
+		++m_currentTick;
+
+		size_t level = 1;
+		while (level < WHEEL_LEVELS && (m_currentTick & ((uint64_t{1} << (WHEEL_LEVEL_BITS * level)) - 1)) == 0) {
+			++level;
+		}
+
+		if (level == WHEEL_LEVELS) {
+			TimerWheelNode* node = m_overflow;
+			m_overflow = nullptr;
+			while (node != nullptr) {
+				TimerWheelNode* next = node->next;
+				Link(node);
+				node = next;
+			}
+		}
+
+		for (size_t i = level - 1; i > 0; --i) {
+			Cascade(i);
+		}
+
+		TimerWheelNode*& head = m_slots[0][m_currentTick & WHEEL_LEVEL_MASK];
+		while (head != nullptr) {
+			TimerWheelNode* node = head;
+			Unlink(node);
+			--m_count;
+			expired.push_back(node);
+		}
+	}
+}
+
+void TimerWheel::Link(TimerWheelNode* node) {
+	uint64_t delta = node->expireTick - m_currentTick;
+
+	for (size_t level = 0; level < WHEEL_LEVELS; ++level) {
+		if (delta < (uint64_t{1} << (WHEEL_LEVEL_BITS * (level + 1)))) {
+			size_t slot = (node->expireTick >> (WHEEL_LEVEL_BITS * level)) & WHEEL_LEVEL_MASK;
+			Push(m_slots[level][slot], node);
+			return;
+		}
+	}
+
+	Push(m_overflow, node);
+}
+
+void TimerWheel::Cascade(size_t level) {
+	TimerWheelNode*& head = m_slots[level][(m_currentTick >> (WHEEL_LEVEL_BITS * level)) & WHEEL_LEVEL_MASK];
+	TimerWheelNode* node = head;
+	head = nullptr;
+
+	while (node != nullptr) {
+		TimerWheelNode* next = node->next;
+		Link(node);
+		node = next;
+	}
+}
+
+void TimerWheel::Push(TimerWheelNode*& head, TimerWheelNode* node) {
+	node->next = head;
+	node->pprev = &head;
+	if (head != nullptr) {
+		head->pprev = &node->next;
+	}
+	head = node;
+}
+
+void TimerWheel::Unlink(TimerWheelNode* node) {
+	*node->pprev = node->next;
+	if (node->next != nullptr) {
+		node->next->pprev = node->pprev;
+	}
+	node->next = nullptr;
+	node->pprev = nullptr;
+}
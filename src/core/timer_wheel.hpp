@@ -0,0 +1,44 @@
+#pragma once
+
+// Intrusive hook embedded into every object scheduled on a TimerWheel.
+struct TimerWheelNode {
+	TimerWheelNode* next{};
+	TimerWheelNode** pprev{};
+	uint64_t expireTick{};
+
+	bool IsScheduled() const {
+		return pprev != nullptr;
+	}
+};
+
+// Hierarchical timing wheel, time is measured in abstract integer ticks.
+// Every level holds 256 slots, a node lands on the lowest level that can represent
+// the distance to its expiry and is cascaded down when the lower level wraps around.
+// Schedule and Cancel are O(1), Advance is O(expired + cascaded).
+class TimerWheel {
+public:
+	static constexpr size_t WHEEL_LEVEL_BITS = 8;
+	static constexpr size_t WHEEL_LEVEL_SIZE = 1 << WHEEL_LEVEL_BITS;
+	static constexpr size_t WHEEL_LEVEL_MASK = WHEEL_LEVEL_SIZE - 1;
+	static constexpr size_t WHEEL_LEVELS = 4;
+
+	void Schedule(TimerWheelNode* node, uint64_t expireTick);
+	void Cancel(TimerWheelNode* node);
+	void Advance(uint64_t tick, std::vector<TimerWheelNode*>& expired);
+
+	uint64_t GetCurrentTick() const { return m_currentTick; }
+	size_t GetCount() const { return m_count; }
+	bool Empty() const { return m_count == 0; }
+
+private:
+	void Link(TimerWheelNode* node);
+	void Cascade(size_t level);
+	static void Push(TimerWheelNode*& head, TimerWheelNode* node);
+	static void Unlink(TimerWheelNode* node);
+
+private:
+	std::array<std::array<TimerWheelNode*, WHEEL_LEVEL_SIZE>, WHEEL_LEVELS> m_slots{};
+	TimerWheelNode* m_overflow{};
+	uint64_t m_currentTick{};
+	size_t m_count{};
+};
@@ -0,0 +1,413 @@
+#include "user_message.hpp"
+
+namespace {
+	template<typename T>
+	struct is_vector : std::false_type {};
+
+	template<typename T>
+	struct is_vector<plg::vector<T>> : std::true_type {};
+
+	template<typename T>
+	bool ConvertFieldValue(const plg::any& value, T& out) {
+		bool converted = false;
+		plg::visit([&](const auto& v) {
+			using V = std::decay_t<decltype(v)>;
+			if constexpr (std::is_arithmetic_v<V>) {
+				out = static_cast<T>(v);
+				converted = true;
+			}
+		}, value);
+		return converted;
+	}
+
+	// Clears the field once the value is known to be a vector of numbers, then adds every element
+	template<typename T, typename Clear, typename Add>
+	bool AddRepeatedValues(const plg::any& value, Clear&& clear, Add&& add) {
+		bool converted = false;
+		plg::visit([&](const auto& v) {
+			using V = std::decay_t<decltype(v)>;
+			if constexpr (is_vector<V>::value) {
+				using E = typename V::value_type;
+				if constexpr (std::is_arithmetic_v<E>) {
+					clear();
+					for (const auto& element : v) {
+						add(static_cast<T>(element));
+					}
+					converted = true;
+				}
+			}
+		}, value);
+		return converted;
+	}
+
+	int ReadColor(const pb::Message& message) {
+		const auto& msgRGBA = static_cast<const CMsgRGBA&>(message);
+		Color color;
+		color.SetColor(msgRGBA.r(), msgRGBA.g(), msgRGBA.b(), msgRGBA.a());
+		return color.GetRawColor();
+	}
+
+	void WriteColor(pb::Message* message, int value) {
+		auto* msgRGBA = static_cast<CMsgRGBA*>(message);
+		const Color& color = *reinterpret_cast<const Color*>(&value);
+		msgRGBA->set_r(color.r());
+		msgRGBA->set_g(color.g());
+		msgRGBA->set_b(color.b());
+		msgRGBA->set_a(color.a());
+	}
+
+	bool ReadMessageField(const pb::Message& message, plg::any& out) {
+		const pb::Descriptor* descriptor = message.GetDescriptor();
+		if (descriptor == CMsgVector::descriptor()) {
+			const auto& msgVec = static_cast<const CMsgVector&>(message);
+			out = plg::vec3{msgVec.x(), msgVec.y(), msgVec.z()};
+		} else if (descriptor == CMsgQAngle::descriptor()) {
+			const auto& msgAng = static_cast<const CMsgQAngle&>(message);
+			out = plg::vec3{msgAng.x(), msgAng.y(), msgAng.z()};
+		} else if (descriptor == CMsgVector2D::descriptor()) {
+			const auto& msgVec2d = static_cast<const CMsgVector2D&>(message);
+			out = plg::vec2{msgVec2d.x(), msgVec2d.y()};
+		} else if (descriptor == CMsgRGBA::descriptor()) {
+			out = ReadColor(message);
+		} else {
+			return false;
+		}
+		return true;
+	}
+
+	// Whether WriteMessageField accepts the value for a message of this type, checked before the message is created
+	bool IsMessageFieldValue(const pb::Descriptor* descriptor, const plg::any& value) {
+		if (descriptor == CMsgVector::descriptor() || descriptor == CMsgQAngle::descriptor()) {
+			return plg::holds_alternative<plg::vec3>(value);
+		}
+		if (descriptor == CMsgVector2D::descriptor()) {
+			return plg::holds_alternative<plg::vec2>(value);
+		}
+		if (descriptor == CMsgRGBA::descriptor()) {
+			int color;
+			return ConvertFieldValue(value, color);
+		}
+		return false;
+	}
+
+	bool WriteMessageField(pb::Message* message, const plg::any& value) {
+		const pb::Descriptor* descriptor = message->GetDescriptor();
+		if (descriptor == CMsgVector::descriptor() || descriptor == CMsgQAngle::descriptor()) {
+			if (!plg::holds_alternative<plg::vec3>(value)) return false;
+			const auto& vec = plg::get<plg::vec3>(value);
+			if (descriptor == CMsgVector::descriptor()) {
+				auto* msgVec = static_cast<CMsgVector*>(message);
+				msgVec->set_x(vec.x);
+				msgVec->set_y(vec.y);
+				msgVec->set_z(vec.z);
+			} else {
+				auto* msgAng = static_cast<CMsgQAngle*>(message);
+				msgAng->set_x(vec.x);
+				msgAng->set_y(vec.y);
+				msgAng->set_z(vec.z);
+			}
+		} else if (descriptor == CMsgVector2D::descriptor()) {
+			if (!plg::holds_alternative<plg::vec2>(value)) return false;
+			const auto& vec = plg::get<plg::vec2>(value);
+			auto* msgVec2d = static_cast<CMsgVector2D*>(message);
+			msgVec2d->set_x(vec.x);
+			msgVec2d->set_y(vec.y);
+		} else if (descriptor == CMsgRGBA::descriptor()) {
+			int color;
+			if (!ConvertFieldValue(value, color)) return false;
+			WriteColor(message, color);
+		} else {
+			return false;
+		}
+		return true;
+	}
+
+	bool ReadField(const pb::Message& msg, const pb::FieldDescriptor* field, plg::any& out) {
+		const pb::Reflection* reflection = msg.GetReflection();
+		switch (field->cpp_type()) {
+			case pb::FieldDescriptor::CPPTYPE_INT32:
+				out = reflection->GetInt32(msg, field);
+				return true;
+			case pb::FieldDescriptor::CPPTYPE_INT64:
+				out = static_cast<int64_t>(reflection->GetInt64(msg, field));
+				return true;
+			case pb::FieldDescriptor::CPPTYPE_UINT32:
+				out = reflection->GetUInt32(msg, field);
+				return true;
+			case pb::FieldDescriptor::CPPTYPE_UINT64:
+				out = static_cast<uint64_t>(reflection->GetUInt64(msg, field));
+				return true;
+			case pb::FieldDescriptor::CPPTYPE_FLOAT:
+				out = reflection->GetFloat(msg, field);
+				return true;
+			case pb::FieldDescriptor::CPPTYPE_DOUBLE:
+				out = reflection->GetDouble(msg, field);
+				return true;
+			case pb::FieldDescriptor::CPPTYPE_BOOL:
+				out = reflection->GetBool(msg, field);
+				return true;
+			case pb::FieldDescriptor::CPPTYPE_ENUM:
+				out = reflection->GetEnum(msg, field)->number();
+				return true;
+			case pb::FieldDescriptor::CPPTYPE_STRING:
+				out = plg::string(reflection->GetString(msg, field));
+				return true;
+			case pb::FieldDescriptor::CPPTYPE_MESSAGE:
+				return ReadMessageField(reflection->GetMessage(msg, field), out);
+			default:
+				return false;
+		}
+	}
+
+	template<typename T, typename Get>
+	plg::vector<T> ReadRepeatedValues(int count, Get&& get) {
+		plg::vector<T> values;
+		values.reserve(static_cast<size_t>(count));
+		for (int i = 0; i < count; ++i) {
+			values.emplace_back(get(i));
+		}
+		return values;
+	}
+
+	bool ReadRepeatedField(const pb::Message& msg, const pb::FieldDescriptor* field, plg::any& out) {
+		const pb::Reflection* reflection = msg.GetReflection();
+		int count = reflection->FieldSize(msg, field);
+		switch (field->cpp_type()) {
+			case pb::FieldDescriptor::CPPTYPE_INT32:
+				out = ReadRepeatedValues<int32_t>(count, [&](int i) { return reflection->GetRepeatedInt32(msg, field, i); });
+				return true;
+			case pb::FieldDescriptor::CPPTYPE_INT64:
+				out = ReadRepeatedValues<int64_t>(count, [&](int i) { return reflection->GetRepeatedInt64(msg, field, i); });
+				return true;
+			case pb::FieldDescriptor::CPPTYPE_UINT32:
+				out = ReadRepeatedValues<uint32_t>(count, [&](int i) { return reflection->GetRepeatedUInt32(msg, field, i); });
+				return true;
+			case pb::FieldDescriptor::CPPTYPE_UINT64:
+				out = ReadRepeatedValues<uint64_t>(count, [&](int i) { return reflection->GetRepeatedUInt64(msg, field, i); });
+				return true;
+			case pb::FieldDescriptor::CPPTYPE_FLOAT:
+				out = ReadRepeatedValues<float>(count, [&](int i) { return reflection->GetRepeatedFloat(msg, field, i); });
+				return true;
+			case pb::FieldDescriptor::CPPTYPE_DOUBLE:
+				out = ReadRepeatedValues<double>(count, [&](int i) { return reflection->GetRepeatedDouble(msg, field, i); });
+				return true;
+			case pb::FieldDescriptor::CPPTYPE_BOOL:
+				out = ReadRepeatedValues<bool>(count, [&](int i) { return reflection->GetRepeatedBool(msg, field, i); });
+				return true;
+			case pb::FieldDescriptor::CPPTYPE_ENUM:
+				out = ReadRepeatedValues<int32_t>(count, [&](int i) { return reflection->GetRepeatedEnum(msg, field, i)->number(); });
+				return true;
+			case pb::FieldDescriptor::CPPTYPE_STRING:
+				out = ReadRepeatedValues<plg::string>(count, [&](int i) { return plg::string(reflection->GetRepeatedString(msg, field, i)); });
+				return true;
+			case pb::FieldDescriptor::CPPTYPE_MESSAGE: {
+				const pb::Descriptor* descriptor = field->message_type();
+				if (descriptor == CMsgVector::descriptor() || descriptor == CMsgQAngle::descriptor()) {
+					out = ReadRepeatedValues<plg::vec3>(count, [&](int i) {
+						plg::any value;
+						ReadMessageField(reflection->GetRepeatedMessage(msg, field, i), value);
+						return plg::get<plg::vec3>(value);
+					});
+				} else if (descriptor == CMsgVector2D::descriptor()) {
+					out = ReadRepeatedValues<plg::vec2>(count, [&](int i) {
+						plg::any value;
+						ReadMessageField(reflection->GetRepeatedMessage(msg, field, i), value);
+						return plg::get<plg::vec2>(value);
+					});
+				} else if (descriptor == CMsgRGBA::descriptor()) {
+					out = ReadRepeatedValues<int32_t>(count, [&](int i) { return ReadColor(reflection->GetRepeatedMessage(msg, field, i)); });
+				} else {
+					return false;
+				}
+				return true;
+			}
+			default:
+				return false;
+		}
+	}
+
+	bool WriteField(pb::Message* msg, const pb::FieldDescriptor* field, const plg::any& value) {
+		const pb::Reflection* reflection = msg->GetReflection();
+		switch (field->cpp_type()) {
+			case pb::FieldDescriptor::CPPTYPE_INT32: {
+				int32_t v;
+				if (!ConvertFieldValue(value, v)) return false;
+				reflection->SetInt32(msg, field, v);
+				return true;
+			}
+			case pb::FieldDescriptor::CPPTYPE_INT64: {
+				int64_t v;
+				if (!ConvertFieldValue(value, v)) return false;
+				reflection->SetInt64(msg, field, v);
+				return true;
+			}
+			case pb::FieldDescriptor::CPPTYPE_UINT32: {
+				uint32_t v;
+				if (!ConvertFieldValue(value, v)) return false;
+				reflection->SetUInt32(msg, field, v);
+				return true;
+			}
+			case pb::FieldDescriptor::CPPTYPE_UINT64: {
+				uint64_t v;
+				if (!ConvertFieldValue(value, v)) return false;
+				reflection->SetUInt64(msg, field, v);
+				return true;
+			}
+			case pb::FieldDescriptor::CPPTYPE_FLOAT: {
+				float v;
+				if (!ConvertFieldValue(value, v)) return false;
+				reflection->SetFloat(msg, field, v);
+				return true;
+			}
+			case pb::FieldDescriptor::CPPTYPE_DOUBLE: {
+				double v;
+				if (!ConvertFieldValue(value, v)) return false;
+				reflection->SetDouble(msg, field, v);
+				return true;
+			}
+			case pb::FieldDescriptor::CPPTYPE_BOOL: {
+				bool v;
+				if (!ConvertFieldValue(value, v)) return false;
+				reflection->SetBool(msg, field, v);
+				return true;
+			}
+			case pb::FieldDescriptor::CPPTYPE_ENUM: {
+				int v;
+				if (!ConvertFieldValue(value, v)) return false;
+				const pb::EnumValueDescriptor* pEnumValue = field->enum_type()->FindValueByNumber(v);
+				if (!pEnumValue) return false;
+				reflection->SetEnum(msg, field, pEnumValue);
+				return true;
+			}
+			case pb::FieldDescriptor::CPPTYPE_STRING:
+				if (!plg::holds_alternative<plg::string>(value)) return false;
+				reflection->SetString(msg, field, std::string(plg::get<plg::string>(value)));
+				return true;
+			case pb::FieldDescriptor::CPPTYPE_MESSAGE:
+				// MutableMessage marks the field as set, so nothing is created for a value that cannot be written
+				if (!IsMessageFieldValue(field->message_type(), value)) return false;
+				return WriteMessageField(reflection->MutableMessage(msg, field), value);
+			default:
+				return false;
+		}
+	}
+
+	bool WriteRepeatedField(pb::Message* msg, const pb::FieldDescriptor* field, const plg::any& value) {
+		const pb::Reflection* reflection = msg->GetReflection();
+		auto clear = [&] { reflection->ClearField(msg, field); };
+
+		switch (field->cpp_type()) {
+			case pb::FieldDescriptor::CPPTYPE_INT32:
+				return AddRepeatedValues<int32_t>(value, clear, [&](int32_t v) { reflection->AddInt32(msg, field, v); });
+			case pb::FieldDescriptor::CPPTYPE_INT64:
+				return AddRepeatedValues<int64_t>(value, clear, [&](int64_t v) { reflection->AddInt64(msg, field, v); });
+			case pb::FieldDescriptor::CPPTYPE_UINT32:
+				return AddRepeatedValues<uint32_t>(value, clear, [&](uint32_t v) { reflection->AddUInt32(msg, field, v); });
+			case pb::FieldDescriptor::CPPTYPE_UINT64:
+				return AddRepeatedValues<uint64_t>(value, clear, [&](uint64_t v) { reflection->AddUInt64(msg, field, v); });
+			case pb::FieldDescriptor::CPPTYPE_FLOAT:
+				return AddRepeatedValues<float>(value, clear, [&](float v) { reflection->AddFloat(msg, field, v); });
+			case pb::FieldDescriptor::CPPTYPE_DOUBLE:
+				return AddRepeatedValues<double>(value, clear, [&](double v) { reflection->AddDouble(msg, field, v); });
+			case pb::FieldDescriptor::CPPTYPE_BOOL:
+				return AddRepeatedValues<bool>(value, clear, [&](bool v) { reflection->AddBool(msg, field, v); });
+			case pb::FieldDescriptor::CPPTYPE_ENUM: {
+				// Every number is resolved before the field is cleared, so an invalid one leaves it untouched
+				std::vector<const pb::EnumValueDescriptor*> enumValues;
+				bool valid = true;
+				bool converted = AddRepeatedValues<int>(value, [] {}, [&](int v) {
+					const pb::EnumValueDescriptor* pEnumValue = field->enum_type()->FindValueByNumber(v);
+					valid = valid && pEnumValue;
+					enumValues.push_back(pEnumValue);
+				});
+				if (!converted || !valid) return false;
+				clear();
+				for (const pb::EnumValueDescriptor* pEnumValue : enumValues) {
+					reflection->AddEnum(msg, field, pEnumValue);
+				}
+				return true;
+			}
+			case pb::FieldDescriptor::CPPTYPE_STRING: {
+				if (!plg::holds_alternative<plg::vector<plg::string>>(value)) return false;
+				clear();
+				for (const auto& element : plg::get<plg::vector<plg::string>>(value)) {
+					reflection->AddString(msg, field, std::string(element));
+				}
+				return true;
+			}
+			case pb::FieldDescriptor::CPPTYPE_MESSAGE: {
+				const pb::Descriptor* descriptor = field->message_type();
+				if (descriptor == CMsgVector::descriptor() || descriptor == CMsgQAngle::descriptor()) {
+					if (!plg::holds_alternative<plg::vector<plg::vec3>>(value)) return false;
+					clear();
+					for (const auto& element : plg::get<plg::vector<plg::vec3>>(value)) {
+						WriteMessageField(reflection->AddMessage(msg, field), plg::any(element));
+					}
+				} else if (descriptor == CMsgVector2D::descriptor()) {
+					if (!plg::holds_alternative<plg::vector<plg::vec2>>(value)) return false;
+					clear();
+					for (const auto& element : plg::get<plg::vector<plg::vec2>>(value)) {
+						WriteMessageField(reflection->AddMessage(msg, field), plg::any(element));
+					}
+				} else if (descriptor == CMsgRGBA::descriptor()) {
+					return AddRepeatedValues<int>(value, clear, [&](int v) { WriteColor(reflection->AddMessage(msg, field), v); });
+				} else {
+					return false;
+				}
+				return true;
+			}
+			default:
+				return false;
+		}
+	}
+} // namespace
+
+void UserMessage::GetFields(plg::vector<plg::any>& out) const {
+	// ListFields only returns set fields and non-empty repeated ones, in field number order
+	std::vector<const pb::FieldDescriptor*> fields;
+	m_msg->GetReflection()->ListFields(*m_msg, &fields);
+
+	out.reserve(out.size() + fields.size() * 2);
+	for (const pb::FieldDescriptor* field : fields) {
+		plg::any value;
+		bool read = field->is_repeated() ? ReadRepeatedField(*m_msg, field, value) : ReadField(*m_msg, field, value);
+		if (!read) {
+			continue;
+		}
+
+		out.emplace_back(plg::string(field->name()));
+		out.emplace_back(std::move(value));
+	}
+}
+
+bool UserMessage::SetFields(const plg::vector<plg::any>& fields) {
+	bool result = true;
+	for (size_t i = 0; i + 1 < fields.size(); i += 2) {
+		if (!plg::holds_alternative<plg::string>(fields[i])) {
+			result = false;
+			continue;
+		}
+
+		const pb::FieldDescriptor* field = FindField(plg::get<plg::string>(fields[i]));
+		if (!field) {
+			result = false;
+			continue;
+		}
+
+		const plg::any& value = fields[i + 1];
+		if (!(field->is_repeated() ? WriteRepeatedField(m_msg, field, value) : WriteField(m_msg, field, value))) {
+			result = false;
+		}
+	}
+	return result && fields.size() % 2 == 0;
+}
+
+bool UserMessage::Serialize(plg::vector<uint8_t>& out) const {
+	size_t size = m_msg->ByteSizeLong();
+	out.resize(size);
+	return m_msg->SerializeToArray(out.data(), static_cast<int>(size));
+}
+
+bool UserMessage::Parse(const plg::vector<uint8_t>& data) {
+	return m_msg->ParseFromArray(data.data(), static_cast<int>(data.size()));
+}
@@ -1,16 +1,20 @@
 #pragma once
 
+#include "net_message_pool.hpp"
+
 #include <networkbasetypes.pb.h>
 #include <networksystem/inetworkmessages.h>
 #include <networksystem/netmessage.h>
 #include <recipientfilter.h>
 
+#include <shared_mutex>
+
 namespace pb = google::protobuf;
 
-#define GETCHECK_FIELD()                                                                   \
-	const pb::FieldDescriptor* field = m_msg->GetDescriptor()->FindFieldByName(fieldName); \
-	if (!field) {                                                                          \
-		return false;                                                                      \
+#define GETCHECK_FIELD()                                       \
+	const pb::FieldDescriptor* field = ResolveField(fieldName); \
+	if (!field) {                                              \
+		return false;                                          \
 	}
 
 #define CHECK_FIELD_TYPE(type)                                      \
@@ -52,11 +56,20 @@ namespace google::protobuf {
 	class Message;
 }
 
+// Either a field name or a field handle from UserMessage::FindField, a handle skips the name lookup.
+struct UserMessageField {
+	UserMessageField(const char* name) : name(name) {}
+	UserMessageField(const pb::FieldDescriptor* handle) : handle(handle) {}
+
+	const char* name{};
+	const pb::FieldDescriptor* handle{};
+};
+
 class UserMessage {
 public:
 	UserMessage(INetworkMessageInternal* msgSerializable, const CNetMessage* message, uint64_t recipients)
 		: m_msgSerializable(msgSerializable), m_netMessage(const_cast<CNetMessage*>(message)), m_msg(const_cast<pb::Message*>(message->AsMessage())),
-		  m_recipients(message->GetBufType())
+		  m_descriptor(m_msg->GetDescriptor()), m_fieldIndex(&GetFieldIndex(m_descriptor)), m_recipients(message->GetBufType())
 	{
 		m_recipients.SetRecipients(recipients);
 	}
@@ -65,8 +78,10 @@ public:
 		m_msgSerializable = g_pNetworkMessages->FindNetworkMessagePartial(messageName);
 		if (!m_msgSerializable) return;
 
-		m_netMessage = m_msgSerializable->AllocateMessage();
+		m_netMessage = g_NetMessagePool.Acquire(m_msgSerializable);
 		m_msg = const_cast<pb::Message*>(m_netMessage->AsMessage());
+		m_descriptor = m_msg->GetDescriptor();
+		m_fieldIndex = &GetFieldIndex(m_descriptor);
 		m_manuallyAllocated = true;
 	}
 
@@ -74,14 +89,16 @@ public:
 		m_msgSerializable = g_pNetworkMessages->FindNetworkMessageById(messageId);
 		if (!m_msgSerializable) return;
 
-		m_netMessage = m_msgSerializable->AllocateMessage();
+		m_netMessage = g_NetMessagePool.Acquire(m_msgSerializable);
 		m_msg = const_cast<pb::Message*>(m_netMessage->AsMessage());
+		m_descriptor = m_msg->GetDescriptor();
+		m_fieldIndex = &GetFieldIndex(m_descriptor);
 		m_manuallyAllocated = true;
 	}
 
 	~UserMessage() {
 		if (m_manuallyAllocated) {
-			delete m_netMessage;
+			g_NetMessagePool.Release(m_msgSerializable, m_netMessage);
 		}
 	}
 
@@ -91,33 +108,80 @@ public:
 	const pb::Message* GetProtobufMessage() const { return m_msg; }
 	INetworkMessageInternal* GetSerializableMessage() const { return m_msgSerializable; }
 	CRecipientFilter& GetRecipientFilter() { return m_recipients; }
+	void Clear() { m_msg->Clear(); }
 
-	bool HasField(const std::string& fieldName) {
-		const pb::Descriptor* descriptor = m_msg->GetDescriptor();
-		const pb::FieldDescriptor* field = descriptor->FindFieldByName(fieldName);
-
-		if (field == nullptr || (field->label() == pb::FieldDescriptor::LABEL_REPEATED)) {
-			return false;
-		}
+	// Typed access to the generated protobuf class, nullptr if the message is of another type
+	template<typename T>
+	T* As() { return m_descriptor == T::descriptor() ? static_cast<T*>(m_msg) : nullptr; }
 
-		return m_msg->GetReflection()->HasField(*m_msg, field);
+	// Field handles stay valid for every message of the same type, the descriptors are never freed.
+	const pb::FieldDescriptor* FindField(std::string_view fieldName) const {
+		if (!m_fieldIndex) return nullptr;
+		auto it = m_fieldIndex->find(fieldName);
+		return it != m_fieldIndex->end() ? it->second : nullptr;
 	}
 
 private:
+	using FieldIndex = std::unordered_map<std::string_view, const pb::FieldDescriptor*>;
+
 	INetworkMessageInternal* m_msgSerializable{};
 	CNetMessage* m_netMessage{};
 	pb::Message* m_msg{};
+	const pb::Descriptor* m_descriptor{};
+	// Resolved once per message, so name lookups on it never take the index lock
+	const FieldIndex* m_fieldIndex{};
 	CRecipientFilter m_recipients;
 	bool m_manuallyAllocated{};
 
+	// Messages can be inspected from worker threads, so the index is only built under the exclusive lock
+	static inline std::unordered_map<const pb::Descriptor*, FieldIndex> s_fieldIndex;
+	static inline std::shared_mutex s_fieldIndexLock;
+
+	static const FieldIndex& GetFieldIndex(const pb::Descriptor* descriptor) {
+		{
+			std::shared_lock lock(s_fieldIndexLock);
+			auto it = s_fieldIndex.find(descriptor);
+			if (it != s_fieldIndex.end()) {
+				return it->second;
+			}
+		}
+
+		// FindFieldByName builds the full "package.Message.field" name on each call, so the fields are indexed once per type.
+		// A built index is never changed again and map nodes do not move, so the reference outlives the lock.
+		std::unique_lock lock(s_fieldIndexLock);
+		auto [it, inserted] = s_fieldIndex.try_emplace(descriptor);
+		if (inserted) {
+			auto& fields = it->second;
+			fields.reserve(static_cast<size_t>(descriptor->field_count()));
+			for (int i = 0; i < descriptor->field_count(); ++i) {
+				const pb::FieldDescriptor* field = descriptor->field(i);
+				fields.emplace(field->name(), field);
+			}
+		}
+
+		return it->second;
+	}
+
+	const pb::FieldDescriptor* ResolveField(UserMessageField fieldName) const {
+		if (fieldName.handle) {
+			// A handle of another message type would index the wrong reflection data
+			return fieldName.handle->containing_type() == m_descriptor ? fieldName.handle : nullptr;
+		}
+		// A null handle from a failed FindField arrives here as neither
+		if (!fieldName.name) {
+			return nullptr;
+		}
+		return FindField(fieldName.name);
+	}
+
 public:
-	bool HasField(const char* fieldName) {
+	bool HasField(UserMessageField fieldName) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_NOT_REPEATED();
 		return m_msg->GetReflection()->HasField(*m_msg, field);
 	}
 
-	bool GetEnum(const char* fieldName, int* out) {
+	bool GetEnum(UserMessageField fieldName, int* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(ENUM);
 		CHECK_FIELD_NOT_REPEATED();
@@ -126,7 +190,7 @@ public:
 		return true;
 	}
 
-	bool SetEnum(const char* fieldName, int value) {
+	bool SetEnum(UserMessageField fieldName, int value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(ENUM);
 		CHECK_FIELD_NOT_REPEATED();
@@ -137,7 +201,7 @@ public:
 		return true;
 	}
 
-	bool GetRepeatedEnum(const char* fieldName, int index, int* out) {
+	bool GetRepeatedEnum(UserMessageField fieldName, int index, int* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(ENUM);
 		CHECK_FIELD_REPEATED();
@@ -147,7 +211,7 @@ public:
 		return true;
 	}
 
-	bool SetRepeatedEnum(const char* fieldName, int index, int value) {
+	bool SetRepeatedEnum(UserMessageField fieldName, int index, int value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(ENUM);
 		CHECK_FIELD_REPEATED();
@@ -159,7 +223,7 @@ public:
 		return true;
 	}
 
-	bool AddEnum(const char* fieldName, int value) {
+	bool AddEnum(UserMessageField fieldName, int value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(ENUM);
 		CHECK_FIELD_REPEATED();
@@ -170,7 +234,7 @@ public:
 		return true;
 	}
 
-	bool GetInt32(const char* fieldName, int32_t* out) {
+	bool GetInt32(UserMessageField fieldName, int32_t* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(INT32);
 		CHECK_FIELD_NOT_REPEATED();
@@ -179,7 +243,7 @@ public:
 		return true;
 	}
 
-	bool SetInt32(const char* fieldName, int32_t value) {
+	bool SetInt32(UserMessageField fieldName, int32_t value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(INT32);
 		CHECK_FIELD_NOT_REPEATED();
@@ -188,7 +252,7 @@ public:
 		return true;
 	}
 
-	bool GetRepeatedInt32(const char* fieldName, int index, int32_t* out) {
+	bool GetRepeatedInt32(UserMessageField fieldName, int index, int32_t* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(INT32);
 		CHECK_FIELD_REPEATED();
@@ -198,7 +262,7 @@ public:
 		return true;
 	}
 
-	bool SetRepeatedInt32(const char* fieldName, int index, int32_t value) {
+	bool SetRepeatedInt32(UserMessageField fieldName, int index, int32_t value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(INT32);
 		CHECK_FIELD_REPEATED();
@@ -208,7 +272,7 @@ public:
 		return true;
 	}
 
-	bool AddInt32(const char* fieldName, int32_t value) {
+	bool AddInt32(UserMessageField fieldName, int32_t value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(INT32);
 		CHECK_FIELD_REPEATED();
@@ -217,7 +281,7 @@ public:
 		return true;
 	}
 
-	bool GetInt64(const char* fieldName, int64_t* out) {
+	bool GetInt64(UserMessageField fieldName, int64_t* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(INT64);
 		CHECK_FIELD_NOT_REPEATED();
@@ -226,7 +290,7 @@ public:
 		return true;
 	}
 
-	bool SetInt64(const char* fieldName, int64_t value) {
+	bool SetInt64(UserMessageField fieldName, int64_t value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(INT64);
 		CHECK_FIELD_NOT_REPEATED();
@@ -235,7 +299,7 @@ public:
 		return true;
 	}
 
-	bool GetRepeatedInt64(const char* fieldName, int index, int64_t* out) {
+	bool GetRepeatedInt64(UserMessageField fieldName, int index, int64_t* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(INT64);
 		CHECK_FIELD_REPEATED();
@@ -245,7 +309,7 @@ public:
 		return true;
 	}
 
-	bool SetRepeatedInt64(const char* fieldName, int index, int64_t value) {
+	bool SetRepeatedInt64(UserMessageField fieldName, int index, int64_t value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(INT64);
 		CHECK_FIELD_REPEATED();
@@ -255,7 +319,7 @@ public:
 		return true;
 	}
 
-	bool AddInt64(const char* fieldName, int64_t value) {
+	bool AddInt64(UserMessageField fieldName, int64_t value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(INT64);
 		CHECK_FIELD_REPEATED();
@@ -264,7 +328,7 @@ public:
 		return true;
 	}
 
-	bool GetUInt32(const char* fieldName, uint32_t* out) {
+	bool GetUInt32(UserMessageField fieldName, uint32_t* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(UINT32);
 		CHECK_FIELD_NOT_REPEATED();
@@ -273,7 +337,7 @@ public:
 		return true;
 	}
 
-	bool SetUInt32(const char* fieldName, uint32_t value) {
+	bool SetUInt32(UserMessageField fieldName, uint32_t value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(UINT32);
 		CHECK_FIELD_NOT_REPEATED();
@@ -282,7 +346,7 @@ public:
 		return true;
 	}
 
-	bool GetRepeatedUInt32(const char* fieldName, int index, uint32_t* out) {
+	bool GetRepeatedUInt32(UserMessageField fieldName, int index, uint32_t* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(UINT32);
 		CHECK_FIELD_REPEATED();
@@ -292,7 +356,7 @@ public:
 		return true;
 	}
 
-	bool SetRepeatedUInt32(const char* fieldName, int index, uint32_t value) {
+	bool SetRepeatedUInt32(UserMessageField fieldName, int index, uint32_t value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(UINT32);
 		CHECK_FIELD_REPEATED();
@@ -302,7 +366,7 @@ public:
 		return true;
 	}
 
-	bool AddUInt32(const char* fieldName, uint32_t value) {
+	bool AddUInt32(UserMessageField fieldName, uint32_t value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(UINT32);
 		CHECK_FIELD_REPEATED();
@@ -311,7 +375,7 @@ public:
 		return true;
 	}
 
-	bool GetUInt64(const char* fieldName, uint64_t* out) {
+	bool GetUInt64(UserMessageField fieldName, uint64_t* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(UINT64);
 		CHECK_FIELD_NOT_REPEATED();
@@ -320,7 +384,7 @@ public:
 		return true;
 	}
 
-	bool SetUInt64(const char* fieldName, uint64_t value) {
+	bool SetUInt64(UserMessageField fieldName, uint64_t value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(UINT64);
 		CHECK_FIELD_NOT_REPEATED();
@@ -329,7 +393,7 @@ public:
 		return true;
 	}
 
-	bool GetRepeatedUInt64(const char* fieldName, int index, uint64_t* out) {
+	bool GetRepeatedUInt64(UserMessageField fieldName, int index, uint64_t* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(UINT64);
 		CHECK_FIELD_REPEATED();
@@ -339,7 +403,7 @@ public:
 		return true;
 	}
 
-	bool SetRepeatedUInt64(const char* fieldName, int index, uint64_t value) {
+	bool SetRepeatedUInt64(UserMessageField fieldName, int index, uint64_t value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(UINT64);
 		CHECK_FIELD_REPEATED();
@@ -349,7 +413,7 @@ public:
 		return true;
 	}
 
-	bool AddUInt64(const char* fieldName, uint64_t value) {
+	bool AddUInt64(UserMessageField fieldName, uint64_t value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(UINT64);
 		CHECK_FIELD_REPEATED();
@@ -358,7 +422,7 @@ public:
 		return true;
 	}
 
-	bool GetBool(const char* fieldName, bool* out) {
+	bool GetBool(UserMessageField fieldName, bool* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(BOOL);
 		CHECK_FIELD_NOT_REPEATED();
@@ -367,7 +431,7 @@ public:
 		return true;
 	}
 
-	bool SetBool(const char* fieldName, bool value) {
+	bool SetBool(UserMessageField fieldName, bool value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(BOOL);
 		CHECK_FIELD_NOT_REPEATED();
@@ -376,7 +440,7 @@ public:
 		return true;
 	}
 
-	bool GetRepeatedBool(const char* fieldName, int index, bool* out) {
+	bool GetRepeatedBool(UserMessageField fieldName, int index, bool* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(BOOL);
 		CHECK_FIELD_REPEATED();
@@ -386,7 +450,7 @@ public:
 		return true;
 	}
 
-	bool SetRepeatedBool(const char* fieldName, int index, bool value) {
+	bool SetRepeatedBool(UserMessageField fieldName, int index, bool value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(BOOL);
 		CHECK_FIELD_REPEATED();
@@ -396,7 +460,7 @@ public:
 		return true;
 	}
 
-	bool AddBool(const char* fieldName, bool value) {
+	bool AddBool(UserMessageField fieldName, bool value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(BOOL);
 		CHECK_FIELD_REPEATED();
@@ -405,7 +469,7 @@ public:
 		return true;
 	}
 
-	bool GetFloat(const char* fieldName, float* out) {
+	bool GetFloat(UserMessageField fieldName, float* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(FLOAT);
 		CHECK_FIELD_NOT_REPEATED();
@@ -414,7 +478,7 @@ public:
 		return true;
 	}
 
-	bool SetFloat(const char* fieldName, float value) {
+	bool SetFloat(UserMessageField fieldName, float value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(FLOAT);
 		CHECK_FIELD_NOT_REPEATED();
@@ -423,7 +487,7 @@ public:
 		return true;
 	}
 
-	bool GetRepeatedFloat(const char* fieldName, int index, float* out) {
+	bool GetRepeatedFloat(UserMessageField fieldName, int index, float* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(FLOAT);
 		CHECK_FIELD_REPEATED();
@@ -433,7 +497,7 @@ public:
 		return true;
 	}
 
-	bool SetRepeatedFloat(const char* fieldName, int index, float value) {
+	bool SetRepeatedFloat(UserMessageField fieldName, int index, float value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(FLOAT);
 		CHECK_FIELD_REPEATED();
@@ -443,7 +507,7 @@ public:
 		return true;
 	}
 
-	bool AddFloat(const char* fieldName, float value) {
+	bool AddFloat(UserMessageField fieldName, float value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(FLOAT);
 		CHECK_FIELD_REPEATED();
@@ -452,7 +516,7 @@ public:
 		return true;
 	}
 
-	bool GetDouble(const char* fieldName, double* out) {
+	bool GetDouble(UserMessageField fieldName, double* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(DOUBLE);
 		CHECK_FIELD_NOT_REPEATED();
@@ -461,7 +525,7 @@ public:
 		return true;
 	}
 
-	bool SetDouble(const char* fieldName, double value) {
+	bool SetDouble(UserMessageField fieldName, double value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(DOUBLE);
 		CHECK_FIELD_NOT_REPEATED();
@@ -470,7 +534,7 @@ public:
 		return true;
 	}
 
-	bool GetRepeatedDouble(const char* fieldName, int index, double* out) {
+	bool GetRepeatedDouble(UserMessageField fieldName, int index, double* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(DOUBLE);
 		CHECK_FIELD_REPEATED();
@@ -480,7 +544,7 @@ public:
 		return true;
 	}
 
-	bool SetRepeatedDouble(const char* fieldName, int index, double value) {
+	bool SetRepeatedDouble(UserMessageField fieldName, int index, double value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(DOUBLE);
 		CHECK_FIELD_REPEATED();
@@ -490,7 +554,7 @@ public:
 		return true;
 	}
 
-	bool AddDouble(const char* fieldName, double value) {
+	bool AddDouble(UserMessageField fieldName, double value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(DOUBLE);
 		CHECK_FIELD_REPEATED();
@@ -499,7 +563,7 @@ public:
 		return true;
 	}
 
-	bool GetString(const char* fieldName, plg::string& out) {
+	bool GetString(UserMessageField fieldName, plg::string& out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(STRING);
 		CHECK_FIELD_NOT_REPEATED();
@@ -509,7 +573,7 @@ public:
 		return true;
 	}
 
-	bool SetString(const char* fieldName, std::string value) {
+	bool SetString(UserMessageField fieldName, std::string value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(STRING);
 		CHECK_FIELD_NOT_REPEATED();
@@ -518,7 +582,7 @@ public:
 		return true;
 	}
 
-	bool GetRepeatedString(const char* fieldName, int index, plg::string& out) {
+	bool GetRepeatedString(UserMessageField fieldName, int index, plg::string& out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(STRING);
 		CHECK_FIELD_REPEATED();
@@ -529,7 +593,7 @@ public:
 		return true;
 	}
 
-	bool SetRepeatedString(const char* fieldName, int index, std::string value) {
+	bool SetRepeatedString(UserMessageField fieldName, int index, std::string value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(STRING);
 		CHECK_FIELD_REPEATED();
@@ -540,7 +604,7 @@ public:
 		return true;
 	}
 
-	bool AddString(const char* fieldName, const char* value) {
+	bool AddString(UserMessageField fieldName, const char* value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(STRING);
 		CHECK_FIELD_REPEATED();
@@ -549,7 +613,7 @@ public:
 		return true;
 	}
 
-	bool GetColor(const char* fieldName, Color* out) {
+	bool GetColor(UserMessageField fieldName, Color* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_NOT_REPEATED();
@@ -560,7 +624,7 @@ public:
 		return true;
 	}
 
-	bool SetColor(const char* fieldName, const Color& value) {
+	bool SetColor(UserMessageField fieldName, const Color& value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_NOT_REPEATED();
@@ -574,7 +638,7 @@ public:
 		return true;
 	}
 
-	bool GetRepeatedColor(const char* fieldName, int index, Color* out) {
+	bool GetRepeatedColor(UserMessageField fieldName, int index, Color* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_REPEATED();
@@ -586,7 +650,7 @@ public:
 		return true;
 	}
 
-	bool SetRepeatedColor(const char* fieldName, int index, const Color& value) {
+	bool SetRepeatedColor(UserMessageField fieldName, int index, const Color& value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_REPEATED();
@@ -601,7 +665,7 @@ public:
 		return true;
 	}
 
-	bool AddColor(const char* fieldName, const Color& value) {
+	bool AddColor(UserMessageField fieldName, const Color& value) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_REPEATED();
@@ -615,7 +679,7 @@ public:
 		return true;
 	}
 
-	bool GetVector2D(const char* fieldName, Vector2D* out) {
+	bool GetVector2D(UserMessageField fieldName, Vector2D* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_NOT_REPEATED();
@@ -626,7 +690,7 @@ public:
 		return true;
 	}
 
-	bool SetVector2D(const char* fieldName, const Vector2D& vec) {
+	bool SetVector2D(UserMessageField fieldName, const Vector2D& vec) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_NOT_REPEATED();
@@ -638,7 +702,7 @@ public:
 		return true;
 	}
 
-	bool GetRepeatedVector2D(const char* fieldName, int index, Vector2D* out) {
+	bool GetRepeatedVector2D(UserMessageField fieldName, int index, Vector2D* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_REPEATED();
@@ -650,7 +714,7 @@ public:
 		return true;
 	}
 
-	bool SetRepeatedVector2D(const char* fieldName, int index, const Vector2D& vec) {
+	bool SetRepeatedVector2D(UserMessageField fieldName, int index, const Vector2D& vec) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_REPEATED();
@@ -663,7 +727,7 @@ public:
 		return true;
 	}
 
-	bool AddVector2D(const char* fieldName, const Vector2D& vec) {
+	bool AddVector2D(UserMessageField fieldName, const Vector2D& vec) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_REPEATED();
@@ -675,7 +739,7 @@ public:
 		return true;
 	}
 
-	bool GetVector(const char* fieldName, Vector* out) {
+	bool GetVector(UserMessageField fieldName, Vector* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_NOT_REPEATED();
@@ -686,7 +750,7 @@ public:
 		return true;
 	}
 
-	bool SetVector(const char* fieldName, const Vector& vec) {
+	bool SetVector(UserMessageField fieldName, const Vector& vec) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_NOT_REPEATED();
@@ -699,7 +763,7 @@ public:
 		return true;
 	}
 
-	bool GetRepeatedVector(const char* fieldName, int index, Vector* out) {
+	bool GetRepeatedVector(UserMessageField fieldName, int index, Vector* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_REPEATED();
@@ -711,7 +775,7 @@ public:
 		return true;
 	}
 
-	bool SetRepeatedVector(const char* fieldName, int index, const Vector& vec) {
+	bool SetRepeatedVector(UserMessageField fieldName, int index, const Vector& vec) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_REPEATED();
@@ -725,7 +789,7 @@ public:
 		return true;
 	}
 
-	bool AddVector(const char* fieldName, const Vector& vec) {
+	bool AddVector(UserMessageField fieldName, const Vector& vec) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_REPEATED();
@@ -738,7 +802,7 @@ public:
 		return true;
 	}
 
-	bool GetQAngle(const char* fieldName, QAngle* out) {
+	bool GetQAngle(UserMessageField fieldName, QAngle* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_NOT_REPEATED();
@@ -749,7 +813,7 @@ public:
 		return true;
 	}
 
-	bool SetQAngle(const char* fieldName, const QAngle& vec) {
+	bool SetQAngle(UserMessageField fieldName, const QAngle& vec) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_NOT_REPEATED();
@@ -762,7 +826,7 @@ public:
 		return true;
 	}
 
-	bool GetRepeatedQAngle(const char* fieldName, int index, QAngle* out) {
+	bool GetRepeatedQAngle(UserMessageField fieldName, int index, QAngle* out) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_REPEATED();
@@ -774,7 +838,7 @@ public:
 		return true;
 	}
 
-	bool SetRepeatedQAngle(const char* fieldName, int index, const QAngle& vec) {
+	bool SetRepeatedQAngle(UserMessageField fieldName, int index, const QAngle& vec) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_REPEATED();
@@ -788,7 +852,7 @@ public:
 		return true;
 	}
 
-	bool AddQAngle(const char* fieldName, const QAngle& vec) {
+	bool AddQAngle(UserMessageField fieldName, const QAngle& vec) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_REPEATED();
@@ -801,7 +865,7 @@ public:
 		return true;
 	}
 
-	bool GetMessage(const char* fieldName, pb::Message** message) {
+	bool GetMessage(UserMessageField fieldName, pb::Message** message) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_NOT_REPEATED();
@@ -811,7 +875,7 @@ public:
 		return true;
 	}
 
-	bool GetRepeatedMessage(const char* fieldName, int index, const pb::Message** message) {
+	bool GetRepeatedMessage(UserMessageField fieldName, int index, const pb::Message** message) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_REPEATED();
@@ -823,7 +887,7 @@ public:
 		return true;
 	}
 
-	bool AddMessage(const char* fieldName, pb::Message** message) {
+	bool AddMessage(UserMessageField fieldName, pb::Message** message) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_TYPE(MESSAGE);
 		CHECK_FIELD_REPEATED();
@@ -833,8 +897,8 @@ public:
 		return true;
 	}
 
-	int GetRepeatedFieldCount(const char* fieldName) {
-		const pb::FieldDescriptor* field = m_msg->GetDescriptor()->FindFieldByName(fieldName);
+	int GetRepeatedFieldCount(UserMessageField fieldName) {
+		const pb::FieldDescriptor* field = ResolveField(fieldName);
 		if (!field) return -1;
 
 		if (field->label() != pb::FieldDescriptor::LABEL_REPEATED) return -1;
@@ -842,7 +906,7 @@ public:
 		return m_msg->GetReflection()->FieldSize(*m_msg, field);
 	}
 
-	bool RemoveRepeatedFieldValue(const char* fieldName, int index) {
+	bool RemoveRepeatedFieldValue(UserMessageField fieldName, int index) {
 		GETCHECK_FIELD();
 		CHECK_FIELD_REPEATED();
 		CHECK_REPEATED_ELEMENT(index);
@@ -858,5 +922,13 @@ public:
 		return true;
 	}
 
+	// Name and value pairs of every present field, repeated fields as one vector each.
+	// Vector, angle and color messages become vec3, vec2 and int values, other nested messages are skipped.
+	void GetFields(plg::vector<plg::any>& out) const;
+	bool SetFields(const plg::vector<plg::any>& fields);
+
+	bool Serialize(plg::vector<uint8_t>& out) const;
+	bool Parse(const plg::vector<uint8_t>& data);
+
 	std::string GetDebugString() { return m_msg->DebugString(); }
 };
\ No newline at end of file
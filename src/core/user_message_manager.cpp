@@ -5,39 +5,73 @@ bool UserMessageManager::HookUserMessage(int16_t messageId, UserMessageCallback
 	std::lock_guard<std::mutex> lock(m_registerCmdLock);
 	
 	if (messageId == 0) {
-		return m_globalCallbacks[static_cast<size_t>(mode)].Register(callback);
+		bool registered = m_globalCallbacks[static_cast<size_t>(mode)].Register(callback);
+		UpdateActiveHooks(mode);
+		return registered;
 	}
 
-	auto it = m_hooksMap.find(messageId);
-	if (it == m_hooksMap.end()) {
-		auto& commandInfo = m_hooksMap.emplace(messageId, UserMessageHook{}).first->second;
-		return commandInfo.callbacks[static_cast<size_t>(mode)].Register(callback);
-	} else {
-		auto& commandInfo = std::get<UserMessageHook>(*it);
-		return commandInfo.callbacks[static_cast<size_t>(mode)].Register(callback);
+	size_t index = static_cast<uint16_t>(messageId);
+	if (index >= m_hooks.size()) {
+		m_hooks.resize(index + 1);
 	}
+
+	auto& messageHook = m_hooks[index];
+	if (!messageHook) {
+		messageHook = std::make_unique<UserMessageHook>();
+		messageHook->callbacks[static_cast<size_t>(HookMode::Pre)].SetName(std::format("usermessage:{}:pre", messageId));
+		messageHook->callbacks[static_cast<size_t>(HookMode::Post)].SetName(std::format("usermessage:{}:post", messageId));
+	}
+
+	bool registered = messageHook->callbacks[static_cast<size_t>(mode)].Register(callback);
+	UpdateActiveHooks(mode);
+	return registered;
 }
 
 bool UserMessageManager::UnhookUserMessage(int16_t messageId, UserMessageCallback callback, HookMode mode) {
 	std::lock_guard<std::mutex> lock(m_registerCmdLock);
 	
 	if (messageId == 0) {
-		return m_globalCallbacks[static_cast<size_t>(mode)].Unregister(callback);
+		bool unregistered = m_globalCallbacks[static_cast<size_t>(mode)].Unregister(callback);
+		UpdateActiveHooks(mode);
+		return unregistered;
 	}
 
-	auto it = m_hooksMap.find(messageId);
-	if (it == m_hooksMap.end()) {
+	size_t index = static_cast<uint16_t>(messageId);
+	if (index >= m_hooks.size() || !m_hooks[index]) {
 		return false;
 	}
 
-	auto& commandInfo = std::get<UserMessageHook>(*it);
-	return commandInfo.callbacks[static_cast<size_t>(mode)].Unregister(callback);
+	bool unregistered = m_hooks[index]->callbacks[static_cast<size_t>(mode)].Unregister(callback);
+	UpdateActiveHooks(mode);
+	return unregistered;
+}
+
+void UserMessageManager::UpdateActiveHooks(HookMode mode) {
+	auto& activeHooks = m_activeHooks[static_cast<size_t>(mode)];
+
+	if (!m_globalCallbacks[static_cast<size_t>(mode)].Empty()) {
+		activeHooks.set();
+		return;
+	}
+
+	activeHooks.reset();
+	for (size_t i = 0; i < m_hooks.size(); ++i) {
+		if (m_hooks[i] && !m_hooks[i]->callbacks[static_cast<size_t>(mode)].Empty()) {
+			activeHooks.set(i);
+		}
+	}
 }
 
 ResultType UserMessageManager::ExecuteMessageCallbacks(INetworkMessageInternal* msgSerializable, const CNetMessage* msgData, uint64_t* clients, HookMode mode) {
-	UserMessage message(msgSerializable, msgData, *clients);
+	int16_t messageID = msgSerializable->GetNetMessageInfo()->m_MessageId;
+	size_t index = static_cast<uint16_t>(messageID);
 
-	int16_t messageID = message.GetMessageID();
+	// Most messages are not hooked at all, so skip building the wrapper and its recipient filter
+	if (!m_activeHooks[static_cast<size_t>(mode)].test(index)) {
+		return ResultType::Continue;
+	}
+
+	UserMessage message(msgSerializable, msgData, *clients);
 	
 	//S2_LOGF(LS_DEBUG, "[CUserMessageManager::ExecuteMessageCallbacks][{}] Pushing user message `{}` pointer: %p\n", mode == HookMode::Pre ? "Pre" : "Post",  messageID, pEvent);
 
@@ -45,8 +79,9 @@ ResultType UserMessageManager::ExecuteMessageCallbacks(INetworkMessageInternal*
 	
 	const auto& globalCallback = m_globalCallbacks[static_cast<size_t>(mode)];
 
-	for (size_t i = 0; i < globalCallback.GetCount(); ++i) {
-		auto thisResult = globalCallback.Notify(i, &message);
+	const auto globalSnapshot = globalCallback.GetSnapshot();
+	for (const auto& listener : globalSnapshot) {
+		auto thisResult = globalSnapshot.Notify(listener, &message);
 		if (thisResult >= ResultType::Stop) {
 			if (mode == HookMode::Pre) {
 				*clients = *reinterpret_cast<const uint64_t *>(message.GetRecipientFilter().GetRecipients().Base());
@@ -61,13 +96,12 @@ ResultType UserMessageManager::ExecuteMessageCallbacks(INetworkMessageInternal*
 		}
 	}
 	
-	auto it = m_hooksMap.find(messageID);
-	if (it != m_hooksMap.end()) {
-		const auto& messageHook = std::get<UserMessageHook>(*it);
-		const auto& callback = messageHook.callbacks[static_cast<size_t>(mode)];
+	if (index < m_hooks.size() && m_hooks[index]) {
+		const auto& callback = m_hooks[index]->callbacks[static_cast<size_t>(mode)];
 
-		for (size_t i = 0; i < callback.GetCount(); ++i) {
-			auto thisResult = callback.Notify(i, &message);
+		const auto snapshot = callback.GetSnapshot();
+		for (const auto& listener : snapshot) {
+			auto thisResult = snapshot.Notify(listener, &message);
 			if (thisResult >= ResultType::Handled) {
 				if (mode == HookMode::Pre) {
 					*clients = *reinterpret_cast<const uint64_t *>(message.GetRecipientFilter().GetRecipients().Base());
@@ -22,8 +22,16 @@ public:
 	ResultType ExecuteMessageCallbacks(INetworkMessageInternal* msgSerializable, const CNetMessage* msgData, uint64_t* clients, HookMode mode);
 
 private:
-	std::unordered_map<int16_t, UserMessageHook> m_hooksMap;
-	std::array<ListenerManager<UserMessageCallback>, 2> m_globalCallbacks;
+	static constexpr size_t MAX_MESSAGE_ID = 1 << 16;
+
+	void UpdateActiveHooks(HookMode mode);
+
+private:
+	// Indexed by the message id, entries are never freed so a running snapshot stays valid
+	std::vector<std::unique_ptr<UserMessageHook>> m_hooks;
+	// Set for every message id that has a hook of that mode, all set while a global callback exists
+	std::array<std::bitset<MAX_MESSAGE_ID>, 2> m_activeHooks;
+	std::array<ListenerManager<UserMessageCallback>, 2> m_globalCallbacks{ListenerManager<UserMessageCallback>("usermessage:*:pre"), ListenerManager<UserMessageCallback>("usermessage:*:post")};
 	std::mutex m_registerCmdLock;
 };
 
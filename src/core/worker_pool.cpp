@@ -0,0 +1,196 @@
+#include "worker_pool.hpp"
+
+#include <convar.h>
+
+#include "sdk/utils.h"
+
+#if S2SDK_PLATFORM_WINDOWS
+#include <windows.h>
+#elif S2SDK_PLATFORM_LINUX
+#include <pthread.h>
+#endif
+
+CConVar<int> s2_worker_threads("s2_worker_threads", FCVAR_NONE, "Number of worker threads for off-thread plugin jobs, pass 0 to use one less than the number of cores. Applied the next time a job is queued while the pool is idle.", 0,
+	[](CConVar<int> *cvar, CSplitScreenSlot slot, const int *new_val, const int *old_val)
+	{
+		g_WorkerPool.RequestRestart();
+	});
+
+CConVar<CUtlString> s2_worker_affinity("s2_worker_affinity", FCVAR_NONE, "CPU indices separated by commas that worker threads are pinned to in turn, leave empty to let the OS schedule them. Applied the next time a job is queued while the pool is idle.", CUtlString(""),
+	[](CConVar<CUtlString> *cvar, CSplitScreenSlot slot, const CUtlString *new_val, const CUtlString *old_val)
+	{
+		g_WorkerPool.RequestRestart();
+	});
+
+WorkerPool::~WorkerPool() {
+	Stop();
+}
+
+void WorkerPool::Start(size_t count, const std::vector<int>& affinity) {
+	Stop();
+
+	m_stop = false;
+	m_restart.store(false, std::memory_order_relaxed);
+	m_workers.reserve(count);
+	for (size_t i = 0; i < count; ++i) {
+		m_workers.emplace_back(std::make_unique<Worker>());
+	}
+
+	// Threads start after every deque exists, since workers steal from each other
+	for (size_t i = 0; i < count; ++i) {
+		auto& thread = m_workers[i]->thread;
+		thread = std::thread(&WorkerPool::WorkerLoop, this, i);
+		if (!affinity.empty()) {
+			SetAffinity(thread, affinity[i % affinity.size()]);
+		}
+	}
+
+	S2_LOGF(LS_DEBUG, "Started {} worker threads\n", count);
+}
+
+void WorkerPool::StartDefault() {
+	int count = s2_worker_threads.Get();
+	if (count <= 0) {
+		count = std::max(static_cast<int>(std::thread::hardware_concurrency()) - 1, 1);
+	}
+
+	std::vector<int> affinity;
+	for (const auto& item : utils::split(s2_worker_affinity.Get().Get(), ", \t")) {
+		if (auto cpu = utils::string_to_int<int>(item)) {
+			affinity.emplace_back(*cpu);
+		} else {
+			S2_LOGF(LS_WARNING, "Ignoring invalid CPU index \"{}\" in s2_worker_affinity\n", item);
+		}
+	}
+
+	Start(static_cast<size_t>(count), affinity);
+}
+
+void WorkerPool::Stop() {
+	if (m_workers.empty())
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(m_sleepLock);
+		m_stop = true;
+	}
+	m_wake.notify_all();
+
+	// Workers exit only after the queued jobs are done, so no job is lost
+	for (auto& worker : m_workers) {
+		if (worker->thread.joinable()) {
+			worker->thread.join();
+		}
+	}
+
+	m_workers.clear();
+}
+
+void WorkerPool::QueueJob(WorkerJobCallback job, TaskCallback continuation, const plg::vector<plg::any>& userData) {
+	size_t index = s_workerIndex;
+	if (index == SIZE_MAX) {
+		// Only the main thread starts and restarts the pool, another thread would race it over the workers
+		if (!IsMainThread()) {
+			S2_LOG(LS_WARNING, "Worker jobs can only be queued from the main thread or from another worker job\n");
+			return;
+		}
+
+		// Workers are only joined once idle, so a cvar change never stalls the main thread on running jobs
+		if (m_restart.load(std::memory_order_relaxed) && m_active.load(std::memory_order_acquire) == 0) {
+			Stop();
+		}
+
+		// Pool is started lazily from the main thread, so cvars are already registered
+		if (m_workers.empty()) {
+			StartDefault();
+		}
+		index = m_nextWorker.fetch_add(1, std::memory_order_relaxed) % m_workers.size();
+	}
+
+	{
+		auto& worker = *m_workers[index];
+		std::lock_guard<std::mutex> lock(worker.lock);
+		worker.jobs.emplace_back(job, continuation, userData);
+	}
+
+	m_active.fetch_add(1, std::memory_order_relaxed);
+	m_pending.fetch_add(1, std::memory_order_release);
+
+	{
+		std::lock_guard<std::mutex> lock(m_sleepLock);
+	}
+	m_wake.notify_one();
+}
+
+bool WorkerPool::IsMainThread() const {
+	return std::this_thread::get_id() == m_mainThreadId;
+}
+
+bool WorkerPool::PopJob(size_t index, Job& job) {
+	{
+		auto& worker = *m_workers[index];
+		std::lock_guard<std::mutex> lock(worker.lock);
+		if (!worker.jobs.empty()) {
+			job = std::move(worker.jobs.front());
+			worker.jobs.pop_front();
+			m_pending.fetch_sub(1, std::memory_order_acq_rel);
+			return true;
+		}
+	}
+
+	for (size_t i = 1; i < m_workers.size(); ++i) {
+		auto& victim = *m_workers[(index + i) % m_workers.size()];
+		std::lock_guard<std::mutex> lock(victim.lock);
+		if (!victim.jobs.empty()) {
+			job = std::move(victim.jobs.back());
+			victim.jobs.pop_back();
+			m_pending.fetch_sub(1, std::memory_order_acq_rel);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void WorkerPool::WorkerLoop(size_t index) {
+	s_workerIndex = index;
+
+	Job job;
+	while (true) {
+		if (PopJob(index, job)) {
+			job.callback(job.userData);
+			if (job.continuation != nullptr) {
+				g_ServerManager.AddTaskForNextFrame(job.continuation, job.userData);
+			}
+			m_active.fetch_sub(1, std::memory_order_release);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(m_sleepLock);
+		m_wake.wait(lock, [this] { return m_stop || m_pending.load(std::memory_order_acquire) != 0; });
+		if (m_stop && m_pending.load(std::memory_order_acquire) == 0) {
+			break;
+		}
+	}
+
+	s_workerIndex = SIZE_MAX;
+}
+
+void WorkerPool::SetAffinity(std::thread& thread, int cpu) {
+	if (cpu < 0)
+		return;
+
+#if S2SDK_PLATFORM_WINDOWS
+	SetThreadAffinityMask(thread.native_handle(), DWORD_PTR{1} << cpu);
+#elif S2SDK_PLATFORM_LINUX
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+	pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#else
+	// macOS has no hard affinity, workers are left to the scheduler
+	(void)thread;
+#endif
+}
+
+WorkerPool g_WorkerPool;
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "server_manager.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+using WorkerJobCallback = void (*)(plg::vector<plg::any>&);
+
+// Work-stealing thread pool for plugin work that must stay off the game thread.
+// Every worker owns a deque: it takes its own jobs from the front and steals from the back of the others.
+// Continuations are handed to ServerManager and run on the main thread in the next frame.
+// Jobs are queued from the main thread or from other jobs, which may run on any worker.
+class WorkerPool {
+public:
+	~WorkerPool();
+
+	void Start(size_t count, const std::vector<int>& affinity);
+	void Stop();
+	void RequestRestart() { m_restart.store(true, std::memory_order_relaxed); }
+
+	void QueueJob(WorkerJobCallback job, TaskCallback continuation, const plg::vector<plg::any>& userData);
+
+	size_t GetWorkerCount() const { return m_workers.size(); }
+
+private:
+	struct Job {
+		WorkerJobCallback callback{};
+		TaskCallback continuation{};
+		plg::vector<plg::any> userData;
+	};
+
+	struct Worker {
+		std::mutex lock;
+		std::deque<Job> jobs;
+		std::thread thread;
+	};
+
+	void StartDefault();
+	void WorkerLoop(size_t index);
+	bool PopJob(size_t index, Job& job);
+
+	bool IsMainThread() const;
+
+	static void SetAffinity(std::thread& thread, int cpu);
+
+private:
+	std::vector<std::unique_ptr<Worker>> m_workers;
+	std::atomic<size_t> m_nextWorker{};
+	std::atomic<size_t> m_pending{};
+	std::atomic<size_t> m_active{}; // queued or running, a nested job is counted before its parent finishes
+	std::atomic<bool> m_restart{};
+	std::mutex m_sleepLock;
+	std::condition_variable m_wake;
+	bool m_stop{};
+	std::thread::id m_mainThreadId{std::this_thread::get_id()};
+
+	static inline thread_local size_t s_workerIndex = SIZE_MAX;
+};
+
+extern WorkerPool g_WorkerPool;
\ No newline at end of file
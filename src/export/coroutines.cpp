@@ -0,0 +1,103 @@
+#include <core/coroutine_scheduler.hpp>
+#include <plugin_export.h>
+
+PLUGIFY_WARN_PUSH()
+
+#if defined(__clang)
+PLUGIFY_WARN_IGNORE("-Wreturn-type-c-linkage")
+#elif defined(_MSC_VER)
+PLUGIFY_WARN_IGNORE(4190)
+#endif
+
+/**
+ * @brief Starts a resumable task driven by a step callback.
+ *
+ * The first step runs on the next frame. Inside each step the callback picks how long
+ * to wait before the next step with one of the TaskWait functions. A step that picks
+ * no wait finishes the task. Tasks are main thread only, like every other function here.
+ *
+ * @param callback The function to be called on every step of the task.
+ * @param userData An array intended to hold user-related data, allowing for elements of any type.
+ * @return An id of the newly started task, or 0 if called outside the main thread.
+ */
+extern "C" PLUGIN_API uint32_t StartTask(CoroutineStepCallback callback, const plg::vector<plg::any>& userData) {
+	return g_CoroutineScheduler.StartTask(callback, userData);
+}
+
+/**
+ * @brief Resumes the task after the given number of seconds.
+ *
+ * Must be called from the step callback of the task.
+ *
+ * @param id An id of the task.
+ * @param seconds The time in seconds to wait before the next step.
+ * @return True if the wait was set, false if the task does not exist or is cancelled.
+ */
+extern "C" PLUGIN_API bool TaskWaitSeconds(uint32_t id, double seconds) {
+	return g_CoroutineScheduler.SetWait(id, CoroutineWait::Seconds, seconds);
+}
+
+/**
+ * @brief Resumes the task after the given number of server ticks.
+ *
+ * Must be called from the step callback of the task.
+ *
+ * @param id An id of the task.
+ * @param ticks The number of server ticks to wait before the next step.
+ * @return True if the wait was set, false if the task does not exist or is cancelled.
+ */
+extern "C" PLUGIN_API bool TaskWaitTicks(uint32_t id, int ticks) {
+	return g_CoroutineScheduler.SetWait(id, CoroutineWait::Ticks, ticks);
+}
+
+/**
+ * @brief Resumes the task on the next frame.
+ *
+ * Must be called from the step callback of the task.
+ *
+ * @param id An id of the task.
+ * @return True if the wait was set, false if the task does not exist or is cancelled.
+ */
+extern "C" PLUGIN_API bool TaskWaitNextFrame(uint32_t id) {
+	return g_CoroutineScheduler.SetWait(id, CoroutineWait::NextFrame);
+}
+
+/**
+ * @brief Resumes the task on the next world update.
+ *
+ * Must be called from the step callback of the task.
+ *
+ * @param id An id of the task.
+ * @return True if the wait was set, false if the task does not exist or is cancelled.
+ */
+extern "C" PLUGIN_API bool TaskWaitNextWorldUpdate(uint32_t id) {
+	return g_CoroutineScheduler.SetWait(id, CoroutineWait::NextWorldUpdate);
+}
+
+/**
+ * @brief Cancels a running task.
+ *
+ * The step callback is not called again once the task is cancelled. A waiting task
+ * is released right away, a task cancelled from its own step ends when the step returns.
+ * Must be called from the main thread.
+ *
+ * @param id An id of the task.
+ * @return True if the task was found, false otherwise.
+ */
+extern "C" PLUGIN_API bool CancelTask(uint32_t id) {
+	return g_CoroutineScheduler.CancelTask(id);
+}
+
+/**
+ * @brief Checks whether a task is still running.
+ *
+ * Must be called from the main thread.
+ *
+ * @param id An id of the task.
+ * @return True if the task exists and is not cancelled, false otherwise.
+ */
+extern "C" PLUGIN_API bool IsTaskRunning(uint32_t id) {
+	return g_CoroutineScheduler.IsTaskRunning(id);
+}
+
+PLUGIFY_WARN_POP()
@@ -1,7 +1,9 @@
 #include <core/sdk/entity/cbaseentity.h>
 #include <core/sdk/utils.h>
+#include <core/frame_scheduler.hpp>
 #include <core/server_manager.hpp>
 #include <core/timer_system.hpp>
+#include <core/worker_pool.hpp>
 #include <engine/IEngineSound.h>
 #include <entity2/entitysystem.h>
 #include <plugin_export.h>
@@ -239,6 +241,58 @@ extern "C" PLUGIN_API void QueueTaskForNextWorldUpdate(TaskCallback callback, co
 	g_ServerManager.AddTaskForNextWorldUpdate(callback, userData);
 }
 
+/**
+ * @brief Queues a job to be executed on a worker thread.
+ *
+ * The job runs off the game thread and must not touch engine state. It can write its
+ * results into the user data, which is then passed to the continuation on the next frame.
+ * Must be called from the main thread or from another worker job, calls from other threads are ignored.
+ *
+ * @param job A callback function to be executed on a worker thread.
+ * @param continuation A callback function to be executed on the main thread after the job, can be null.
+ * @param userData An array intended to hold user-related data, allowing for elements of any type.
+ */
+extern "C" PLUGIN_API void QueueTaskOnWorker(WorkerJobCallback job, TaskCallback continuation, const plg::vector<plg::any>& userData) {
+	g_WorkerPool.QueueJob(job, continuation, userData);
+}
+
+/**
+ * @brief Registers work to be executed every frame in the given phase.
+ *
+ * Work runs in priority order after the core work of the phase. When the frame work of a tick
+ * exceeds its share of the tick interval, non-critical work is skipped for that tick unless it has
+ * not run for longer than its deadline.
+ *
+ * @param phase The frame phase to run the work in.
+ * @param callback A callback function to be executed every frame.
+ * @param priority The priority of the work, lower values run first and Critical work is never skipped.
+ * @param deadline The longest time in milliseconds the work may be skipped for, pass 0 to allow skipping it indefinitely.
+ * @param userData An array intended to hold user-related data, allowing for elements of any type.
+ * @return An id of the registered work, or 0 if the phase is invalid.
+ */
+extern "C" PLUGIN_API uint32_t AddFrameWork(FramePhase phase, FrameWorkCallback callback, FramePriority priority, double deadline, const plg::vector<plg::any>& userData) {
+	return g_FrameScheduler.AddWork(phase, callback, priority, deadline, userData);
+}
+
+/**
+ * @brief Unregisters work added with AddFrameWork.
+ *
+ * @param id An id of the registered work.
+ * @return True if the work was found and removed, false otherwise.
+ */
+extern "C" PLUGIN_API bool RemoveFrameWork(uint32_t id) {
+	return g_FrameScheduler.RemoveWork(id);
+}
+
+/**
+ * @brief Returns how many times frame work was skipped to hold the tick rate.
+ *
+ * @return The number of skipped frame work runs since the plugin was loaded.
+ */
+extern "C" PLUGIN_API uint64_t GetFrameWorkShedCount() {
+	return g_FrameScheduler.GetShedCount();
+}
+
 /**
  * @brief Returns the duration of a specified sound.
  *
@@ -68,6 +68,18 @@ extern "C" PLUGIN_API void CancelCreatedEvent(EventInfo* info) {
 	g_EventManager.CancelCreatedEvent(info);
 }
 
+/**
+ * @brief Returns how many event copies for post hooks were skipped.
+ *
+ * A copy is skipped when an event has no post listeners left, or when a pre hook
+ * superseded it and post hooks could read the original event instead.
+ *
+ * @return The number of skipped event copies since the plugin was loaded.
+ */
+extern "C" PLUGIN_API uint64_t GetAvoidedEventCopyCount() {
+	return g_EventManager.GetAvoidedDuplicateCount();
+}
+
 /**
  * @brief Retrieves the boolean value of a game event's key.
  * @param info A pointer to the EventInfo structure containing event data.
@@ -326,6 +338,372 @@ extern "C" PLUGIN_API void SetEventBroadcast(EventInfo* info, bool dontBroadcast
 	info->dontBroadcast = dontBroadcast;
 }
 
+/**
+ * @brief Resolves key names of a game event into key handles.
+ *
+ * Handles are resolved once and stay valid until the plugin is unloaded. The ByKey accessors
+ * take them instead of a key name and skip hashing the name on every call.
+ *
+ * @param name The name of the event the keys belong to.
+ * @param keys The key names to resolve.
+ * @return An array of key handles in the order of the key names, or an empty array if the event does not exist.
+ */
+extern "C" PLUGIN_API plg::vector<EventKey*> ResolveEventKeys(const plg::string& name, const plg::vector<plg::string>& keys) {
+	return g_EventManager.ResolveEventKeys(name, keys);
+}
+
+/**
+ * @brief Retrieves the boolean value of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to retrieve the boolean value.
+ * @return The boolean value associated with the key.
+ */
+extern "C" PLUGIN_API bool GetEventBoolByKey(EventInfo* info, EventKey* key) {
+	return info->event->GetBool(key->symbol);
+}
+
+/**
+ * @brief Retrieves the float value of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to retrieve the float value.
+ * @return The float value associated with the key.
+ */
+extern "C" PLUGIN_API float GetEventFloatByKey(EventInfo* info, EventKey* key) {
+	return info->event->GetFloat(key->symbol);
+}
+
+/**
+ * @brief Retrieves the integer value of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to retrieve the integer value.
+ * @return The integer value associated with the key.
+ */
+extern "C" PLUGIN_API int GetEventIntByKey(EventInfo* info, EventKey* key) {
+	return info->event->GetInt(key->symbol);
+}
+
+/**
+ * @brief Retrieves the long integer value of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to retrieve the long integer value.
+ * @return The long integer value associated with the key.
+ */
+extern "C" PLUGIN_API uint64_t GetEventUInt64ByKey(EventInfo* info, EventKey* key) {
+	return info->event->GetUint64(key->symbol);
+}
+
+/**
+ * @brief Retrieves the string value of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to retrieve the string value.
+ * @return A string where the result will be stored.
+ */
+extern "C" PLUGIN_API plg::string GetEventStringByKey(EventInfo* info, EventKey* key) {
+	return info->event->GetString(key->symbol);
+}
+
+/**
+ * @brief Retrieves the pointer value of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to retrieve the pointer value.
+ * @return The pointer value associated with the key.
+ */
+extern "C" PLUGIN_API void* GetEventPtrByKey(EventInfo* info, EventKey* key) {
+	return info->event->GetPtr(key->symbol);
+}
+
+/**
+ * @brief Retrieves the player controller address of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to retrieve the player controller address.
+ * @return A pointer to the player controller associated with the key.
+ */
+extern "C" PLUGIN_API CEntityInstance* GetEventPlayerControllerByKey(EventInfo* info, EventKey* key) {
+	return info->event->GetPlayerController(key->symbol);
+}
+
+/**
+ * @brief Retrieves the player index of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to retrieve the player index.
+ * @return The player index associated with the key.
+ */
+extern "C" PLUGIN_API int GetEventPlayerIndexByKey(EventInfo* info, EventKey* key) {
+	return info->event->GetPlayerSlot(key->symbol).Get();
+}
+
+/**
+ * @brief Retrieves the player pawn address of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to retrieve the player pawn address.
+ * @return A pointer to the player pawn associated with the key.
+ */
+extern "C" PLUGIN_API CEntityInstance* GetEventPlayerPawnByKey(EventInfo* info, EventKey* key) {
+	return info->event->GetPlayerPawn(key->symbol);
+}
+
+/**
+ * @brief Retrieves the entity address of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to retrieve the entity address.
+ * @return A pointer to the entity associated with the key.
+ */
+extern "C" PLUGIN_API CEntityInstance* GetEventEntityByKey(EventInfo* info, EventKey* key) {
+	return info->event->GetEntity(key->symbol);
+}
+
+/**
+ * @brief Retrieves the entity index of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to retrieve the entity index.
+ * @return The entity index associated with the key.
+ */
+extern "C" PLUGIN_API int GetEventEntityIndexByKey(EventInfo* info, EventKey* key) {
+	return info->event->GetEntityIndex(key->symbol).Get();
+}
+
+/**
+ * @brief Retrieves the entity handle of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to retrieve the entity handle.
+ * @return The entity handle associated with the key.
+ */
+extern "C" PLUGIN_API int GetEventEntityHandleByKey(EventInfo* info, EventKey* key) {
+	return info->event->GetEHandle(key->symbol).ToInt();
+}
+
+/**
+ * @brief Sets the boolean value of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to set the boolean value.
+ * @param value The boolean value to set.
+ */
+extern "C" PLUGIN_API void SetEventBoolByKey(EventInfo* info, EventKey* key, bool value) {
+	info->event->SetBool(key->symbol, value);
+}
+
+/**
+ * @brief Sets the floating point value of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to set the float value.
+ * @param value The float value to set.
+ */
+extern "C" PLUGIN_API void SetEventFloatByKey(EventInfo* info, EventKey* key, float value) {
+	info->event->SetFloat(key->symbol, value);
+}
+
+/**
+ * @brief Sets the integer value of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to set the integer value.
+ * @param value The integer value to set.
+ */
+extern "C" PLUGIN_API void SetEventIntByKey(EventInfo* info, EventKey* key, int value) {
+	info->event->SetInt(key->symbol, value);
+}
+
+/**
+ * @brief Sets the long integer value of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to set the long integer value.
+ * @param value The long integer value to set.
+ */
+extern "C" PLUGIN_API void SetEventUInt64ByKey(EventInfo* info, EventKey* key, uint64_t value) {
+	info->event->SetUint64(key->symbol, value);
+}
+
+/**
+ * @brief Sets the string value of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to set the string value.
+ * @param value The string value to set.
+ */
+extern "C" PLUGIN_API void SetEventStringByKey(EventInfo* info, EventKey* key, const plg::string& value) {
+	info->event->SetString(key->symbol, value.c_str());
+}
+
+/**
+ * @brief Sets the pointer value of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to set the pointer value.
+ * @param value The pointer value to set.
+ */
+extern "C" PLUGIN_API void SetEventPtrByKey(EventInfo* info, EventKey* key, void* value) {
+	info->event->SetPtr(key->symbol, value);
+}
+
+/**
+ * @brief Sets the player controller address of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to set the player controller address.
+ * @param value A handle to the player controller to set.
+ */
+extern "C" PLUGIN_API void SetEventPlayerControllerByKey(EventInfo* info, EventKey* key, int value) {
+	CEntityInstance* pEntity = g_pGameEntitySystem->GetEntityInstance(CEntityHandle((uint32) value));
+	if (!pEntity) {
+		return;
+	}
+
+	info->event->SetPlayer(key->symbol, pEntity);
+}
+
+/**
+ * @brief Sets the player index value of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to set the player index value.
+ * @param value The player index value to set.
+ */
+extern "C" PLUGIN_API void SetEventPlayerIndexByKey(EventInfo* info, EventKey* key, int value) {
+	info->event->SetPlayer(key->symbol, CPlayerSlot(value));
+}
+
+/**
+ * @brief Sets the entity address of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to set the entity address.
+ * @param value A handle to the entity to set.
+ */
+extern "C" PLUGIN_API void SetEventEntityByKey(EventInfo* info, EventKey* key, int value) {
+	CEntityInstance* pEntity = g_pGameEntitySystem->GetEntityInstance(CEntityHandle((uint32) value));
+	if (!pEntity) {
+		return;
+	}
+
+	info->event->SetEntity(key->symbol, pEntity);
+}
+
+/**
+ * @brief Sets the entity index of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to set the entity index.
+ * @param value The entity index value to set.
+ */
+extern "C" PLUGIN_API void SetEventEntityIndexByKey(EventInfo* info, EventKey* key, int value) {
+	info->event->SetEntity(key->symbol, CEntityIndex(value));
+}
+
+/**
+ * @brief Sets the entity handle of a game event's key.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param key A resolved key handle for which to set the entity handle.
+ * @param value The entity handle value to set.
+ */
+extern "C" PLUGIN_API void SetEventEntityHandleByKey(EventInfo* info, EventKey* key, int value) {
+	info->event->SetEntity(key->symbol, CEntityHandle((uint32) value).Get());
+}
+
+/**
+ * @brief Creates a reusable template of typed event fields.
+ *
+ * A template resolves its keys once and is used to read or write all of its fields in a
+ * single call with GetEventFields, CreateEventFromTemplate and FireEventFromTemplate.
+ *
+ * @param name The name of the event created from the template.
+ * @param keys The key names of the fields.
+ * @param types The type of each field, in the order of the key names.
+ * @return A pointer to the template, or nullptr if the event does not exist or the arrays differ in size.
+ */
+extern "C" PLUGIN_API EventTemplate* CreateEventTemplate(const plg::string& name, const plg::vector<plg::string>& keys, const plg::vector<EventFieldType>& types) {
+	return g_EventManager.CreateEventTemplate(name, keys, types);
+}
+
+/**
+ * @brief Destroys an event template.
+ * @param eventTemplate A pointer to the template to destroy.
+ * @return True if the template was destroyed, false if it does not exist.
+ */
+extern "C" PLUGIN_API bool DestroyEventTemplate(EventTemplate* eventTemplate) {
+	return g_EventManager.DestroyEventTemplate(eventTemplate);
+}
+
+/**
+ * @brief Reads all fields of a template from a game event in one call.
+ *
+ * The template does not have to be created for the same event, only its keys and types are used.
+ *
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param eventTemplate A pointer to the template describing the fields to read.
+ * @return An array of field values in the order of the template fields.
+ */
+extern "C" PLUGIN_API plg::vector<plg::any> GetEventFields(EventInfo* info, EventTemplate* eventTemplate) {
+	return EventManager::ReadEventFields(info->event, *eventTemplate);
+}
+
+/**
+ * @brief Writes fields of a template to a game event in one call.
+ * @param info A pointer to the EventInfo structure containing event data.
+ * @param eventTemplate A pointer to the template describing the fields to write.
+ * @param values The field values in the order of the template fields. Values of a mismatched type are skipped.
+ */
+extern "C" PLUGIN_API void SetEventFields(EventInfo* info, EventTemplate* eventTemplate, const plg::vector<plg::any>& values) {
+	EventManager::WriteEventFields(info->event, *eventTemplate, values);
+}
+
+/**
+ * @brief Creates a game event from a template and fills its fields.
+ * @param eventTemplate A pointer to the template of the event.
+ * @param values The field values in the order of the template fields.
+ * @param force A boolean indicating whether to force the creation of the event.
+ * @return A pointer to the created EventInfo structure, or nullptr if the event could not be created.
+ */
+extern "C" PLUGIN_API EventInfo* CreateEventFromTemplate(EventTemplate* eventTemplate, const plg::vector<plg::any>& values, bool force) {
+	return g_EventManager.CreateEvent(*eventTemplate, values, force);
+}
+
+/**
+ * @brief Creates, fills and fires a game event from a template in one call.
+ * @param eventTemplate A pointer to the template of the event.
+ * @param values The field values in the order of the template fields.
+ * @param dontBroadcast A boolean indicating whether to broadcast the event.
+ * @return True if the event was created and fired, false if the event does not exist or nobody listens to it.
+ */
+extern "C" PLUGIN_API bool FireEventFromTemplate(EventTemplate* eventTemplate, const plg::vector<plg::any>& values, bool dontBroadcast) {
+	EventInfo* info = g_EventManager.CreateEvent(*eventTemplate, values);
+	if (!info) {
+		return false;
+	}
+
+	g_EventManager.FireEvent(info, dontBroadcast);
+	return true;
+}
+
+/**
+ * @brief Creates a stream that delivers the fields of every fire of an event once per frame.
+ *
+ * Instead of calling a hook for each fire, the chosen fields are captured into a ring buffer
+ * and passed to the callback as one batch at the end of the frame. Use it for consumers that
+ * only log or aggregate and do not need to change or block the event.
+ *
+ * @param name The name of the event to capture.
+ * @param keys The key names of the fields to capture.
+ * @param types The type of each field, in the order of the key names.
+ * @param capacity The number of fires kept per frame, older fires are dropped when it is exceeded.
+ * @param callback The function to be called with the batch of captured fires.
+ * @param userData An array intended to hold user-related data, allowing for elements of any type.
+ * @return An id of the stream, or 0 if the event does not exist or the arguments are invalid.
+ */
+extern "C" PLUGIN_API uint32_t CreateEventStream(const plg::string& name, const plg::vector<plg::string>& keys, const plg::vector<EventFieldType>& types, uint32_t capacity, EventStreamCallback callback, const plg::vector<plg::any>& userData) {
+	return g_EventManager.CreateEventStream(name, keys, types, capacity, callback, userData);
+}
+
+/**
+ * @brief Destroys an event stream, fires not delivered yet are discarded.
+ * @param id An id of the stream.
+ * @return True if the stream was destroyed, false if it does not exist.
+ */
+extern "C" PLUGIN_API bool DestroyEventStream(uint32_t id) {
+	return g_EventManager.DestroyEventStream(id);
+}
+
+/**
+ * @brief Returns how many fires an event stream dropped because its buffer was full.
+ * @param id An id of the stream.
+ * @return The number of dropped fires, or 0 if the stream does not exist.
+ */
+extern "C" PLUGIN_API uint64_t GetEventStreamDropCount(uint32_t id) {
+	return g_EventManager.GetEventStreamDropCount(id);
+}
+
 /**
  * @brief Load game event descriptions from a file (e.g., "resource/gameevents.res").
  * @param path The path to the file containing event descriptions.
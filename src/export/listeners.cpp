@@ -0,0 +1,60 @@
+#include <core/listener_manager.hpp>
+#include <plugin_export.h>
+
+PLUGIFY_WARN_PUSH()
+
+#if defined(__clang)
+PLUGIFY_WARN_IGNORE("-Wreturn-type-c-linkage")
+#elif defined(_MSC_VER)
+PLUGIFY_WARN_IGNORE(4190)
+#endif
+
+/**
+ * @brief Enables or disables timing of every listener callback.
+ *
+ * This is the same switch as the s2_listener_profiling console variable. While disabled,
+ * dispatch skips all timing work.
+ *
+ * @param enable True to start timing callbacks, false to stop.
+ */
+extern "C" PLUGIN_API void SetListenerProfiling(bool enable) {
+	ListenerManagerBase::SetProfiling(enable);
+}
+
+/**
+ * @brief Clears the call counts and times of every listener callback.
+ */
+extern "C" PLUGIN_API void ResetListenerStats() {
+	ListenerManagerBase::ResetAllStats();
+}
+
+/**
+ * @brief Retrieves the cost of every registered listener callback.
+ *
+ * The output arrays are filled in parallel, one element per registered callback.
+ *
+ * @param managers Receives the name of the listener each callback is registered to.
+ * @param callbacks Receives the address of each callback.
+ * @param calls Receives how many times each callback was called while profiling was enabled.
+ * @param totalTimes Receives the cumulative time in milliseconds spent in each callback.
+ * @param maxTimes Receives the longest single call in milliseconds of each callback.
+ */
+extern "C" PLUGIN_API void GetListenerStats(plg::vector<plg::string>& managers, plg::vector<uint64_t>& callbacks, plg::vector<uint64_t>& calls, plg::vector<double>& totalTimes, plg::vector<double>& maxTimes) {
+	auto stats = ListenerManagerBase::CollectAllStats();
+
+	managers.clear();
+	callbacks.clear();
+	calls.clear();
+	totalTimes.clear();
+	maxTimes.clear();
+
+	for (const auto& stat : stats) {
+		managers.emplace_back(stat.manager);
+		callbacks.emplace_back(stat.callback);
+		calls.emplace_back(stat.calls);
+		totalTimes.emplace_back(static_cast<double>(stat.totalNs) / 1e6);
+		maxTimes.emplace_back(static_cast<double>(stat.maxNs) / 1e6);
+	}
+}
+
+PLUGIFY_WARN_POP()
@@ -16,9 +16,9 @@ PLUGIFY_WARN_IGNORE(4190)
  * after the specified delay in seconds. The timer can be configured with various flags
  * to control its behavior.
  *
- * @param delay The time delay in seconds between each callback execution.
+ * @param delay The time delay in seconds between each callback execution, or in server ticks when the Ticks flag is set.
  * @param callback The function to be called when the timer expires.
- * @param flags Flags that modify the behavior of the timer (e.g., no-map change, repeating).
+ * @param flags Flags that modify the behavior of the timer (e.g., no-map change, repeating, tick based).
  * @param userData An array intended to hold user-related data, allowing for elements of any type.
  * @return An id of the newly created CTimer object, or -1 if the timer could not be created.
  */
@@ -51,6 +51,58 @@ extern "C" PLUGIN_API void RescheduleTimer(uint32_t id, double newDelay) {
 	g_TimerSystem.RescheduleTimer(id, newDelay);
 }
 
+/**
+ * @brief Creates a new timer owned by an entity.
+ *
+ * The timer behaves like one made by CreateTimer, but it is killed automatically
+ * when the owning entity is removed, so the callback never sees a stale handle.
+ *
+ * @param entityHandle The handle of the entity that owns the timer.
+ * @param delay The time delay in seconds between each callback execution, or in server ticks when the Ticks flag is set.
+ * @param callback The function to be called when the timer expires.
+ * @param flags Flags that modify the behavior of the timer (e.g., no-map change, repeating, tick based).
+ * @param userData An array intended to hold user-related data, allowing for elements of any type.
+ * @return An id of the newly created CTimer object, or -1 if the timer could not be created.
+ */
+extern "C" PLUGIN_API uint32_t CreateEntityTimer(int entityHandle, double delay, TimerCallback callback, TimerFlag flags, const plg::vector<plg::any>& userData) {
+	return g_TimerSystem.CreateTimer(delay, callback, flags, userData, TimerSystem::MakeOwner(TimerOwnerType::Entity, entityHandle));
+}
+
+/**
+ * @brief Creates a new timer owned by a client.
+ *
+ * The timer behaves like one made by CreateTimer, but it is killed automatically
+ * when the client in the given slot disconnects.
+ *
+ * @param playerSlot The index of the player's slot that owns the timer.
+ * @param delay The time delay in seconds between each callback execution, or in server ticks when the Ticks flag is set.
+ * @param callback The function to be called when the timer expires.
+ * @param flags Flags that modify the behavior of the timer (e.g., no-map change, repeating, tick based).
+ * @param userData An array intended to hold user-related data, allowing for elements of any type.
+ * @return An id of the newly created CTimer object, or -1 if the timer could not be created.
+ */
+extern "C" PLUGIN_API uint32_t CreateClientTimer(int playerSlot, double delay, TimerCallback callback, TimerFlag flags, const plg::vector<plg::any>& userData) {
+	return g_TimerSystem.CreateTimer(delay, callback, flags, userData, TimerSystem::MakeOwner(TimerOwnerType::Player, playerSlot));
+}
+
+/**
+ * @brief Stops and removes every timer owned by an entity.
+ *
+ * @param entityHandle The handle of the entity whose timers should be killed.
+ */
+extern "C" PLUGIN_API void KillEntityTimers(int entityHandle) {
+	g_TimerSystem.KillOwnerTimers(TimerSystem::MakeOwner(TimerOwnerType::Entity, entityHandle));
+}
+
+/**
+ * @brief Stops and removes every timer owned by a client.
+ *
+ * @param playerSlot The index of the player's slot whose timers should be killed.
+ */
+extern "C" PLUGIN_API void KillClientTimers(int playerSlot) {
+	g_TimerSystem.KillOwnerTimers(TimerSystem::MakeOwner(TimerOwnerType::Player, playerSlot));
+}
+
 /**
  * @brief Returns the number of seconds in between game server ticks.
  *
@@ -69,4 +121,23 @@ extern "C" PLUGIN_API double GetTickedTime() {
 	return TimerSystem::GetTickedTime();
 }
 
+/**
+ * @brief Returns the total number of due timers that were carried over to the next frame
+ * because the per-frame timer budget (s2_timer_frame_budget) was spent.
+ *
+ * @return The deferred timers counter.
+ */
+extern "C" PLUGIN_API uint64_t GetTimerDeferredCount() {
+	return g_TimerSystem.GetDeferredTimers();
+}
+
+/**
+ * @brief Returns the number of frames in which timer callbacks exceeded the per-frame timer budget.
+ *
+ * @return The budget overruns counter.
+ */
+extern "C" PLUGIN_API uint64_t GetTimerBudgetOverrunCount() {
+	return g_TimerSystem.GetBudgetOverruns();
+}
+
 PLUGIFY_WARN_POP()
@@ -0,0 +1,469 @@
+// Generated by tools/generate_user_messages.py, do not edit.
+
+#include <core/user_message.hpp>
+#include <usermessages.pb.h>
+#include <plugin_export.h>
+
+PLUGIFY_WARN_PUSH()
+
+#if defined(__clang)
+PLUGIFY_WARN_IGNORE("-Wreturn-type-c-linkage")
+#elif defined(_MSC_VER)
+PLUGIFY_WARN_IGNORE(4190)
+#endif
+
+/**
+ * @brief Gets the dest field of a TextMsg message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return The field value, or a default value if the message is not a TextMsg message.
+ */
+extern "C" PLUGIN_API uint32_t PbTextMsgGetDest(UserMessage* userMessage) {
+	auto* msg = userMessage->As<CUserMessageTextMsg>();
+	if (!msg) return 0;
+	return msg->dest();
+}
+
+/**
+ * @brief Sets the dest field of a TextMsg message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param value The value to set.
+ * @return True if the field was set, false if the message is not a TextMsg message.
+ */
+extern "C" PLUGIN_API bool PbTextMsgSetDest(UserMessage* userMessage, uint32_t value) {
+	auto* msg = userMessage->As<CUserMessageTextMsg>();
+	if (!msg) return false;
+	msg->set_dest(value);
+	return true;
+}
+
+/**
+ * @brief Gets an element of the repeated param field of a TextMsg message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param index The index of the element.
+ * @return The element value, or a default value if the index or the message type is invalid.
+ */
+extern "C" PLUGIN_API plg::string PbTextMsgGetParam(UserMessage* userMessage, int index) {
+	auto* msg = userMessage->As<CUserMessageTextMsg>();
+	if (!msg || index < 0 || index >= msg->param_size()) return {};
+	return msg->param(index);
+}
+
+/**
+ * @brief Gets the number of elements in the repeated param field of a TextMsg message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return The number of elements, or -1 if the message is not a TextMsg message.
+ */
+extern "C" PLUGIN_API int PbTextMsgGetParamCount(UserMessage* userMessage) {
+	auto* msg = userMessage->As<CUserMessageTextMsg>();
+	return msg ? msg->param_size() : -1;
+}
+
+/**
+ * @brief Adds an element to the repeated param field of a TextMsg message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param value The value to add.
+ * @return True if the element was added, false if the message is not a TextMsg message.
+ */
+extern "C" PLUGIN_API bool PbTextMsgAddParam(UserMessage* userMessage, const plg::string& value) {
+	auto* msg = userMessage->As<CUserMessageTextMsg>();
+	if (!msg) return false;
+	msg->add_param(std::string(value));
+	return true;
+}
+
+/**
+ * @brief Gets the entityindex field of a SayText2 message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return The field value, or a default value if the message is not a SayText2 message.
+ */
+extern "C" PLUGIN_API int32_t PbSayText2GetEntityindex(UserMessage* userMessage) {
+	auto* msg = userMessage->As<CUserMessageSayText2>();
+	if (!msg) return 0;
+	return msg->entityindex();
+}
+
+/**
+ * @brief Sets the entityindex field of a SayText2 message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param value The value to set.
+ * @return True if the field was set, false if the message is not a SayText2 message.
+ */
+extern "C" PLUGIN_API bool PbSayText2SetEntityindex(UserMessage* userMessage, int32_t value) {
+	auto* msg = userMessage->As<CUserMessageSayText2>();
+	if (!msg) return false;
+	msg->set_entityindex(value);
+	return true;
+}
+
+/**
+ * @brief Gets the chat field of a SayText2 message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return The field value, or a default value if the message is not a SayText2 message.
+ */
+extern "C" PLUGIN_API bool PbSayText2GetChat(UserMessage* userMessage) {
+	auto* msg = userMessage->As<CUserMessageSayText2>();
+	if (!msg) return false;
+	return msg->chat();
+}
+
+/**
+ * @brief Sets the chat field of a SayText2 message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param value The value to set.
+ * @return True if the field was set, false if the message is not a SayText2 message.
+ */
+extern "C" PLUGIN_API bool PbSayText2SetChat(UserMessage* userMessage, bool value) {
+	auto* msg = userMessage->As<CUserMessageSayText2>();
+	if (!msg) return false;
+	msg->set_chat(value);
+	return true;
+}
+
+/**
+ * @brief Gets the messagename field of a SayText2 message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return The field value, or a default value if the message is not a SayText2 message.
+ */
+extern "C" PLUGIN_API plg::string PbSayText2GetMessagename(UserMessage* userMessage) {
+	auto* msg = userMessage->As<CUserMessageSayText2>();
+	if (!msg) return {};
+	return msg->messagename();
+}
+
+/**
+ * @brief Sets the messagename field of a SayText2 message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param value The value to set.
+ * @return True if the field was set, false if the message is not a SayText2 message.
+ */
+extern "C" PLUGIN_API bool PbSayText2SetMessagename(UserMessage* userMessage, const plg::string& value) {
+	auto* msg = userMessage->As<CUserMessageSayText2>();
+	if (!msg) return false;
+	msg->set_messagename(std::string(value));
+	return true;
+}
+
+/**
+ * @brief Gets the param1 field of a SayText2 message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return The field value, or a default value if the message is not a SayText2 message.
+ */
+extern "C" PLUGIN_API plg::string PbSayText2GetParam1(UserMessage* userMessage) {
+	auto* msg = userMessage->As<CUserMessageSayText2>();
+	if (!msg) return {};
+	return msg->param1();
+}
+
+/**
+ * @brief Sets the param1 field of a SayText2 message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param value The value to set.
+ * @return True if the field was set, false if the message is not a SayText2 message.
+ */
+extern "C" PLUGIN_API bool PbSayText2SetParam1(UserMessage* userMessage, const plg::string& value) {
+	auto* msg = userMessage->As<CUserMessageSayText2>();
+	if (!msg) return false;
+	msg->set_param1(std::string(value));
+	return true;
+}
+
+/**
+ * @brief Gets the param2 field of a SayText2 message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return The field value, or a default value if the message is not a SayText2 message.
+ */
+extern "C" PLUGIN_API plg::string PbSayText2GetParam2(UserMessage* userMessage) {
+	auto* msg = userMessage->As<CUserMessageSayText2>();
+	if (!msg) return {};
+	return msg->param2();
+}
+
+/**
+ * @brief Sets the param2 field of a SayText2 message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param value The value to set.
+ * @return True if the field was set, false if the message is not a SayText2 message.
+ */
+extern "C" PLUGIN_API bool PbSayText2SetParam2(UserMessage* userMessage, const plg::string& value) {
+	auto* msg = userMessage->As<CUserMessageSayText2>();
+	if (!msg) return false;
+	msg->set_param2(std::string(value));
+	return true;
+}
+
+/**
+ * @brief Gets the param3 field of a SayText2 message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return The field value, or a default value if the message is not a SayText2 message.
+ */
+extern "C" PLUGIN_API plg::string PbSayText2GetParam3(UserMessage* userMessage) {
+	auto* msg = userMessage->As<CUserMessageSayText2>();
+	if (!msg) return {};
+	return msg->param3();
+}
+
+/**
+ * @brief Sets the param3 field of a SayText2 message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param value The value to set.
+ * @return True if the field was set, false if the message is not a SayText2 message.
+ */
+extern "C" PLUGIN_API bool PbSayText2SetParam3(UserMessage* userMessage, const plg::string& value) {
+	auto* msg = userMessage->As<CUserMessageSayText2>();
+	if (!msg) return false;
+	msg->set_param3(std::string(value));
+	return true;
+}
+
+/**
+ * @brief Gets the param4 field of a SayText2 message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return The field value, or a default value if the message is not a SayText2 message.
+ */
+extern "C" PLUGIN_API plg::string PbSayText2GetParam4(UserMessage* userMessage) {
+	auto* msg = userMessage->As<CUserMessageSayText2>();
+	if (!msg) return {};
+	return msg->param4();
+}
+
+/**
+ * @brief Sets the param4 field of a SayText2 message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param value The value to set.
+ * @return True if the field was set, false if the message is not a SayText2 message.
+ */
+extern "C" PLUGIN_API bool PbSayText2SetParam4(UserMessage* userMessage, const plg::string& value) {
+	auto* msg = userMessage->As<CUserMessageSayText2>();
+	if (!msg) return false;
+	msg->set_param4(std::string(value));
+	return true;
+}
+
+/**
+ * @brief Gets the command field of a Shake message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return The field value, or a default value if the message is not a Shake message.
+ */
+extern "C" PLUGIN_API uint32_t PbShakeGetCommand(UserMessage* userMessage) {
+	auto* msg = userMessage->As<CUserMessageShake>();
+	if (!msg) return 0;
+	return msg->command();
+}
+
+/**
+ * @brief Sets the command field of a Shake message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param value The value to set.
+ * @return True if the field was set, false if the message is not a Shake message.
+ */
+extern "C" PLUGIN_API bool PbShakeSetCommand(UserMessage* userMessage, uint32_t value) {
+	auto* msg = userMessage->As<CUserMessageShake>();
+	if (!msg) return false;
+	msg->set_command(value);
+	return true;
+}
+
+/**
+ * @brief Gets the amplitude field of a Shake message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return The field value, or a default value if the message is not a Shake message.
+ */
+extern "C" PLUGIN_API float PbShakeGetAmplitude(UserMessage* userMessage) {
+	auto* msg = userMessage->As<CUserMessageShake>();
+	if (!msg) return 0.0f;
+	return msg->amplitude();
+}
+
+/**
+ * @brief Sets the amplitude field of a Shake message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param value The value to set.
+ * @return True if the field was set, false if the message is not a Shake message.
+ */
+extern "C" PLUGIN_API bool PbShakeSetAmplitude(UserMessage* userMessage, float value) {
+	auto* msg = userMessage->As<CUserMessageShake>();
+	if (!msg) return false;
+	msg->set_amplitude(value);
+	return true;
+}
+
+/**
+ * @brief Gets the frequency field of a Shake message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return The field value, or a default value if the message is not a Shake message.
+ */
+extern "C" PLUGIN_API float PbShakeGetFrequency(UserMessage* userMessage) {
+	auto* msg = userMessage->As<CUserMessageShake>();
+	if (!msg) return 0.0f;
+	return msg->frequency();
+}
+
+/**
+ * @brief Sets the frequency field of a Shake message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param value The value to set.
+ * @return True if the field was set, false if the message is not a Shake message.
+ */
+extern "C" PLUGIN_API bool PbShakeSetFrequency(UserMessage* userMessage, float value) {
+	auto* msg = userMessage->As<CUserMessageShake>();
+	if (!msg) return false;
+	msg->set_frequency(value);
+	return true;
+}
+
+/**
+ * @brief Gets the duration field of a Shake message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return The field value, or a default value if the message is not a Shake message.
+ */
+extern "C" PLUGIN_API float PbShakeGetDuration(UserMessage* userMessage) {
+	auto* msg = userMessage->As<CUserMessageShake>();
+	if (!msg) return 0.0f;
+	return msg->duration();
+}
+
+/**
+ * @brief Sets the duration field of a Shake message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param value The value to set.
+ * @return True if the field was set, false if the message is not a Shake message.
+ */
+extern "C" PLUGIN_API bool PbShakeSetDuration(UserMessage* userMessage, float value) {
+	auto* msg = userMessage->As<CUserMessageShake>();
+	if (!msg) return false;
+	msg->set_duration(value);
+	return true;
+}
+
+/**
+ * @brief Gets the duration field of a Fade message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return The field value, or a default value if the message is not a Fade message.
+ */
+extern "C" PLUGIN_API uint32_t PbFadeGetDuration(UserMessage* userMessage) {
+	auto* msg = userMessage->As<CUserMessageFade>();
+	if (!msg) return 0;
+	return msg->duration();
+}
+
+/**
+ * @brief Sets the duration field of a Fade message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param value The value to set.
+ * @return True if the field was set, false if the message is not a Fade message.
+ */
+extern "C" PLUGIN_API bool PbFadeSetDuration(UserMessage* userMessage, uint32_t value) {
+	auto* msg = userMessage->As<CUserMessageFade>();
+	if (!msg) return false;
+	msg->set_duration(value);
+	return true;
+}
+
+/**
+ * @brief Gets the hold_time field of a Fade message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return The field value, or a default value if the message is not a Fade message.
+ */
+extern "C" PLUGIN_API uint32_t PbFadeGetHoldTime(UserMessage* userMessage) {
+	auto* msg = userMessage->As<CUserMessageFade>();
+	if (!msg) return 0;
+	return msg->hold_time();
+}
+
+/**
+ * @brief Sets the hold_time field of a Fade message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param value The value to set.
+ * @return True if the field was set, false if the message is not a Fade message.
+ */
+extern "C" PLUGIN_API bool PbFadeSetHoldTime(UserMessage* userMessage, uint32_t value) {
+	auto* msg = userMessage->As<CUserMessageFade>();
+	if (!msg) return false;
+	msg->set_hold_time(value);
+	return true;
+}
+
+/**
+ * @brief Gets the flags field of a Fade message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return The field value, or a default value if the message is not a Fade message.
+ */
+extern "C" PLUGIN_API uint32_t PbFadeGetFlags(UserMessage* userMessage) {
+	auto* msg = userMessage->As<CUserMessageFade>();
+	if (!msg) return 0;
+	return msg->flags();
+}
+
+/**
+ * @brief Sets the flags field of a Fade message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param value The value to set.
+ * @return True if the field was set, false if the message is not a Fade message.
+ */
+extern "C" PLUGIN_API bool PbFadeSetFlags(UserMessage* userMessage, uint32_t value) {
+	auto* msg = userMessage->As<CUserMessageFade>();
+	if (!msg) return false;
+	msg->set_flags(value);
+	return true;
+}
+
+/**
+ * @brief Gets the color field of a Fade message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return The field value, or a default value if the message is not a Fade message.
+ */
+extern "C" PLUGIN_API uint32_t PbFadeGetColor(UserMessage* userMessage) {
+	auto* msg = userMessage->As<CUserMessageFade>();
+	if (!msg) return 0;
+	return msg->color();
+}
+
+/**
+ * @brief Sets the color field of a Fade message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param value The value to set.
+ * @return True if the field was set, false if the message is not a Fade message.
+ */
+extern "C" PLUGIN_API bool PbFadeSetColor(UserMessage* userMessage, uint32_t value) {
+	auto* msg = userMessage->As<CUserMessageFade>();
+	if (!msg) return false;
+	msg->set_color(value);
+	return true;
+}
+
+PLUGIFY_WARN_POP()
@@ -90,6 +90,85 @@ extern "C" PLUGIN_API void UserMessageSend(UserMessage* userMessage) {
 	g_pGameEventSystem->PostEventAbstract(-1, false, &userMessage->GetRecipientFilter(), userMessage->GetSerializableMessage(), userMessage->GetNetMessage(), 0);
 }
 
+/**
+ * @brief Sends a UserMessage to the given recipients, leaving its own recipient filter untouched.
+ *
+ * A message created once can serve as a template: fill it once, then send it to as many
+ * recipient sets as needed without copying or rebuilding it.
+ *
+ * @param userMessage The UserMessage to send.
+ * @param recipients The recipient mask.
+ */
+extern "C" PLUGIN_API void UserMessageSendTo(UserMessage* userMessage, uint64_t recipients) {
+	CRecipientFilter filter(userMessage->GetNetMessage()->GetBufType());
+	filter.SetRecipients(recipients);
+
+	g_pGameEventSystem->PostEventAbstract(-1, false, &filter, userMessage->GetSerializableMessage(), userMessage->GetNetMessage(), 0);
+}
+
+/**
+ * @brief Clears all fields of a UserMessage so it can be filled again.
+ *
+ * @param userMessage The UserMessage to clear.
+ */
+extern "C" PLUGIN_API void UserMessageClear(UserMessage* userMessage) {
+	userMessage->Clear();
+}
+
+/**
+ * @brief Reads every present field of a UserMessage in one call.
+ *
+ * The result holds name and value pairs, repeated fields are a single array value.
+ * Vector, angle and color messages are read as vec3, vec2 and int values, other nested messages are skipped.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return An array of field names, each followed by the field value.
+ */
+extern "C" PLUGIN_API plg::vector<plg::any> UserMessageGetFields(UserMessage* userMessage) {
+	plg::vector<plg::any> fields;
+	userMessage->GetFields(fields);
+	return fields;
+}
+
+/**
+ * @brief Writes fields of a UserMessage in one call.
+ *
+ * Takes name and value pairs in the layout returned by UserMessageGetFields, a repeated field is replaced as a whole.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param fields An array of field names, each followed by the value to set.
+ * @return True if every field was set, false if any name or value was invalid. Valid pairs are set either way.
+ */
+extern "C" PLUGIN_API bool UserMessageSetFields(UserMessage* userMessage, const plg::vector<plg::any>& fields) {
+	return userMessage->SetFields(fields);
+}
+
+/**
+ * @brief Serializes a UserMessage into its protobuf wire format.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return The serialized message, or an empty array if serialization failed.
+ */
+extern "C" PLUGIN_API plg::vector<uint8_t> UserMessageSerialize(UserMessage* userMessage) {
+	plg::vector<uint8_t> data;
+	if (!userMessage->Serialize(data)) {
+		S2_LOGF(LS_WARNING, "Could not serialize message \"{}\"\n", userMessage->GetProtobufMessage()->GetTypeName());
+		return {};
+	}
+	return data;
+}
+
+/**
+ * @brief Replaces the content of a UserMessage with a serialized message of the same type.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param data The serialized message, as returned by UserMessageSerialize.
+ * @return True if the data was parsed, false otherwise.
+ */
+extern "C" PLUGIN_API bool UserMessageParse(UserMessage* userMessage, const plg::vector<uint8_t>& data) {
+	return userMessage->Parse(data);
+}
+
 /**
  * @brief Gets the name of the message.
  *
@@ -1382,4 +1461,642 @@ extern "C" PLUGIN_API bool PbAddQAngle(UserMessage* userMessage, const plg::stri
 	return userMessage->AddQAngle(fieldName.c_str(), *reinterpret_cast<const QAngle*>(&value));
 }
 
+/**
+ * @brief Finds a field handle of a UserMessage.
+ *
+ * The handle is valid for every message of the same type for the lifetime of the server,
+ * so it can be looked up once and passed to the ByField functions to skip the name lookup.
+ *
+ * @param userMessage Pointer to the UserMessage object.
+ * @param fieldName Name of the field to find.
+ * @return A handle of the field, or nullptr if the message has no such field.
+ */
+extern "C" PLUGIN_API const pb::FieldDescriptor* PbFindField(UserMessage* userMessage, const plg::string& fieldName) {
+	return userMessage->FindField(fieldName);
+}
+
+/**
+ * @brief Reads an enum value from a UserMessage by field handle.
+ *
+ * @param userMessage Pointer to the UserMessage object.
+ * @param field Field handle returned by PbFindField.
+ * @param index Index of the repeated field (use -1 for non-repeated fields).
+ * @return The integer representation of the enum value, or 0 if invalid.
+ */
+extern "C" PLUGIN_API int PbReadEnumByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int index) {
+	int32_t returnValue;
+	if (index < 0) {
+		if (!userMessage->GetEnum(field, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle for message \"{}\"", userMessage->GetProtobufMessage()->GetTypeName());
+			return 0;
+		}
+	} else {
+		if (!userMessage->GetRepeatedEnum(field, index, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle [{}] for message \"{}\"", index, userMessage->GetProtobufMessage()->GetTypeName());
+			return 0;
+		}
+	}
+	return returnValue;
+}
+
+/**
+ * @brief Reads a 32-bit integer from a UserMessage by field handle.
+ *
+ * @param userMessage Pointer to the UserMessage object.
+ * @param field Field handle returned by PbFindField.
+ * @param index Index of the repeated field (use -1 for non-repeated fields).
+ * @return The int32_t value read, or 0 if invalid.
+ */
+extern "C" PLUGIN_API int32_t PbReadInt32ByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int index) {
+	int32_t returnValue;
+	if (index < 0) {
+		if (!userMessage->GetInt32(field, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle for message \"{}\"", userMessage->GetProtobufMessage()->GetTypeName());
+			return 0;
+		}
+	} else {
+		if (!userMessage->GetRepeatedInt32(field, index, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle [{}] for message \"{}\"", index, userMessage->GetProtobufMessage()->GetTypeName());
+			return 0;
+		}
+	}
+	return returnValue;
+}
+
+/**
+ * @brief Reads a 64-bit integer from a UserMessage by field handle.
+ *
+ * @param userMessage Pointer to the UserMessage object.
+ * @param field Field handle returned by PbFindField.
+ * @param index Index of the repeated field (use -1 for non-repeated fields).
+ * @return The int64_t value read, or 0 if invalid.
+ */
+extern "C" PLUGIN_API int64_t PbReadInt64ByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int index) {
+	int64_t returnValue;
+	if (index < 0) {
+		if (!userMessage->GetInt64(field, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle for message \"{}\"", userMessage->GetProtobufMessage()->GetTypeName());
+			return 0;
+		}
+	} else {
+		if (!userMessage->GetRepeatedInt64(field, index, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle [{}] for message \"{}\"", index, userMessage->GetProtobufMessage()->GetTypeName());
+			return 0;
+		}
+	}
+	return returnValue;
+}
+
+/**
+ * @brief Reads an unsigned 32-bit integer from a UserMessage by field handle.
+ *
+ * @param userMessage Pointer to the UserMessage object.
+ * @param field Field handle returned by PbFindField.
+ * @param index Index of the repeated field (use -1 for non-repeated fields).
+ * @return The uint32_t value read, or 0 if invalid.
+ */
+extern "C" PLUGIN_API uint32_t PbReadUInt32ByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int index) {
+	uint32_t returnValue;
+	if (index < 0) {
+		if (!userMessage->GetUInt32(field, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle for message \"{}\"", userMessage->GetProtobufMessage()->GetTypeName());
+			return 0;
+		}
+	} else {
+		if (!userMessage->GetRepeatedUInt32(field, index, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle [{}] for message \"{}\"", index, userMessage->GetProtobufMessage()->GetTypeName());
+			return 0;
+		}
+	}
+	return returnValue;
+}
+
+/**
+ * @brief Reads an unsigned 64-bit integer from a UserMessage by field handle.
+ *
+ * @param userMessage Pointer to the UserMessage object.
+ * @param field Field handle returned by PbFindField.
+ * @param index Index of the repeated field (use -1 for non-repeated fields).
+ * @return The uint64_t value read, or 0 if invalid.
+ */
+extern "C" PLUGIN_API uint64_t PbReadUInt64ByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int index) {
+	uint64_t returnValue;
+	if (index < 0) {
+		if (!userMessage->GetUInt64(field, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle for message \"{}\"", userMessage->GetProtobufMessage()->GetTypeName());
+			return 0;
+		}
+	} else {
+		if (!userMessage->GetRepeatedUInt64(field, index, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle [{}] for message \"{}\"", index, userMessage->GetProtobufMessage()->GetTypeName());
+			return 0;
+		}
+	}
+	return returnValue;
+}
+
+/**
+ * @brief Reads a floating-point value from a UserMessage by field handle.
+ *
+ * @param userMessage Pointer to the UserMessage object.
+ * @param field Field handle returned by PbFindField.
+ * @param index Index of the repeated field (use -1 for non-repeated fields).
+ * @return The float value read, or 0.0 if invalid.
+ */
+extern "C" PLUGIN_API float PbReadFloatByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int index) {
+	float returnValue;
+	if (index < 0) {
+		if (!userMessage->GetFloat(field, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle for message \"{}\"", userMessage->GetProtobufMessage()->GetTypeName());
+			return 0.0f;
+		}
+	} else {
+		if (!userMessage->GetRepeatedFloat(field, index, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle [{}] for message \"{}\"", index, userMessage->GetProtobufMessage()->GetTypeName());
+			return 0.0f;
+		}
+	}
+	return returnValue;
+}
+
+/**
+ * @brief Reads a double-precision floating-point value from a UserMessage by field handle.
+ *
+ * @param userMessage Pointer to the UserMessage object.
+ * @param field Field handle returned by PbFindField.
+ * @param index Index of the repeated field (use -1 for non-repeated fields).
+ * @return The double value read, or 0.0 if invalid.
+ */
+extern "C" PLUGIN_API double PbReadDoubleByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int index) {
+	double returnValue;
+	if (index < 0) {
+		if (!userMessage->GetDouble(field, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle for message \"{}\"", userMessage->GetProtobufMessage()->GetTypeName());
+			return 0.0;
+		}
+	} else {
+		if (!userMessage->GetRepeatedDouble(field, index, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle [{}] for message \"{}\"", index, userMessage->GetProtobufMessage()->GetTypeName());
+			return 0.0;
+		}
+	}
+	return returnValue;
+}
+
+/**
+ * @brief Reads a boolean value from a UserMessage by field handle.
+ *
+ * @param userMessage Pointer to the UserMessage object.
+ * @param field Field handle returned by PbFindField.
+ * @param index Index of the repeated field (use -1 for non-repeated fields).
+ * @return The boolean value read, or false if invalid.
+ */
+extern "C" PLUGIN_API bool PbReadBoolByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int index) {
+	bool returnValue;
+	if (index < 0) {
+		if (!userMessage->GetBool(field, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle for message \"{}\"", userMessage->GetProtobufMessage()->GetTypeName());
+			return false;
+		}
+	} else {
+		if (!userMessage->GetRepeatedBool(field, index, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle [{}] for message \"{}\"", index, userMessage->GetProtobufMessage()->GetTypeName());
+			return false;
+		}
+	}
+	return returnValue;
+}
+
+/**
+ * @brief Reads a string from a UserMessage by field handle.
+ *
+ * @param userMessage Pointer to the UserMessage object.
+ * @param field Field handle returned by PbFindField.
+ * @param index Index of the repeated field (use -1 for non-repeated fields).
+ * @return The string value read, or an empty string if invalid.
+ */
+extern "C" PLUGIN_API plg::string PbReadStringByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int index) {
+	plg::string returnValue;
+	if (index < 0) {
+		if (!userMessage->GetString(field, returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle for message \"{}\"", userMessage->GetProtobufMessage()->GetTypeName());
+			return {};
+		}
+	} else {
+		if (!userMessage->GetRepeatedString(field, index, returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle [{}] for message \"{}\"", index, userMessage->GetProtobufMessage()->GetTypeName());
+			return {};
+		}
+	}
+	return returnValue;
+}
+
+/**
+ * @brief Reads a color value from a UserMessage by field handle.
+ *
+ * @param userMessage Pointer to the UserMessage object.
+ * @param field Field handle returned by PbFindField.
+ * @param index Index of the repeated field (use -1 for non-repeated fields).
+ * @return The color value read, or an empty value if invalid.
+ */
+extern "C" PLUGIN_API int PbReadColorByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int index) {
+	Color returnValue;
+	if (index < 0) {
+		if (!userMessage->GetColor(field, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle for message \"{}\"", userMessage->GetProtobufMessage()->GetTypeName());
+			return {};
+		}
+	} else {
+		if (!userMessage->GetRepeatedColor(field, index, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle [{}] for message \"{}\"", index, userMessage->GetProtobufMessage()->GetTypeName());
+			return {};
+		}
+	}
+	return returnValue.GetRawColor();
+}
+
+/**
+ * @brief Reads a 2D vector from a UserMessage by field handle.
+ *
+ * @param userMessage Pointer to the UserMessage object.
+ * @param field Field handle returned by PbFindField.
+ * @param index Index of the repeated field (use -1 for non-repeated fields).
+ * @return The 2D vector value read, or an empty value if invalid.
+ */
+extern "C" PLUGIN_API plg::vec2 PbReadVector2ByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int index) {
+	Vector2D returnValue;
+	if (index < 0) {
+		if (!userMessage->GetVector2D(field, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle for message \"{}\"", userMessage->GetProtobufMessage()->GetTypeName());
+			return {};
+		}
+	} else {
+		if (!userMessage->GetRepeatedVector2D(field, index, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle [{}] for message \"{}\"", index, userMessage->GetProtobufMessage()->GetTypeName());
+			return {};
+		}
+	}
+	return *reinterpret_cast<plg::vec2*>(&returnValue);
+}
+
+/**
+ * @brief Reads a 3D vector from a UserMessage by field handle.
+ *
+ * @param userMessage Pointer to the UserMessage object.
+ * @param field Field handle returned by PbFindField.
+ * @param index Index of the repeated field (use -1 for non-repeated fields).
+ * @return The 3D vector value read, or an empty value if invalid.
+ */
+extern "C" PLUGIN_API plg::vec3 PbReadVector3ByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int index) {
+	Vector returnValue;
+	if (index < 0) {
+		if (!userMessage->GetVector(field, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle for message \"{}\"", userMessage->GetProtobufMessage()->GetTypeName());
+			return {};
+		}
+	} else {
+		if (!userMessage->GetRepeatedVector(field, index, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle [{}] for message \"{}\"", index, userMessage->GetProtobufMessage()->GetTypeName());
+			return {};
+		}
+	}
+	return *reinterpret_cast<plg::vec3*>(&returnValue);
+}
+
+/**
+ * @brief Reads a QAngle (rotation vector) from a UserMessage by field handle.
+ *
+ * @param userMessage Pointer to the UserMessage object.
+ * @param field Field handle returned by PbFindField.
+ * @param index Index of the repeated field (use -1 for non-repeated fields).
+ * @return The QAngle value read, or an empty value if invalid.
+ */
+extern "C" PLUGIN_API plg::vec3 PbReadQAngleByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int index) {
+	QAngle returnValue;
+	if (index < 0) {
+		if (!userMessage->GetQAngle(field, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle for message \"{}\"", userMessage->GetProtobufMessage()->GetTypeName());
+			return {};
+		}
+	} else {
+		if (!userMessage->GetRepeatedQAngle(field, index, &returnValue)) {
+			S2_LOGF(LS_WARNING, "Invalid field handle [{}] for message \"{}\"", index, userMessage->GetProtobufMessage()->GetTypeName());
+			return {};
+		}
+	}
+	return *reinterpret_cast<plg::vec3*>(&returnValue);
+}
+
+/**
+ * @brief Sets an enum value for a field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to set.
+ * @return True if the field was successfully set, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbSetEnumByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int value) {
+	return userMessage->SetEnum(field, value);
+}
+
+/**
+ * @brief Sets a 32-bit integer for a field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to set.
+ * @return True if the field was successfully set, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbSetInt32ByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int32_t value) {
+	return userMessage->SetInt32(field, value);
+}
+
+/**
+ * @brief Sets a 64-bit integer for a field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to set.
+ * @return True if the field was successfully set, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbSetInt64ByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int64_t value) {
+	return userMessage->SetInt64(field, value);
+}
+
+/**
+ * @brief Sets an unsigned 32-bit integer for a field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to set.
+ * @return True if the field was successfully set, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbSetUInt32ByField(UserMessage* userMessage, const pb::FieldDescriptor* field, uint32_t value) {
+	return userMessage->SetUInt32(field, value);
+}
+
+/**
+ * @brief Sets an unsigned 64-bit integer for a field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to set.
+ * @return True if the field was successfully set, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbSetUInt64ByField(UserMessage* userMessage, const pb::FieldDescriptor* field, uint64_t value) {
+	return userMessage->SetUInt64(field, value);
+}
+
+/**
+ * @brief Sets a floating-point value for a field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to set.
+ * @return True if the field was successfully set, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbSetFloatByField(UserMessage* userMessage, const pb::FieldDescriptor* field, float value) {
+	return userMessage->SetFloat(field, value);
+}
+
+/**
+ * @brief Sets a double-precision floating-point value for a field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to set.
+ * @return True if the field was successfully set, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbSetDoubleByField(UserMessage* userMessage, const pb::FieldDescriptor* field, double value) {
+	return userMessage->SetDouble(field, value);
+}
+
+/**
+ * @brief Sets a boolean value for a field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to set.
+ * @return True if the field was successfully set, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbSetBoolByField(UserMessage* userMessage, const pb::FieldDescriptor* field, bool value) {
+	return userMessage->SetBool(field, value);
+}
+
+/**
+ * @brief Sets a string for a field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to set.
+ * @return True if the field was successfully set, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbSetStringByField(UserMessage* userMessage, const pb::FieldDescriptor* field, const plg::string& value) {
+	return userMessage->SetString(field, std::string(value));
+}
+
+/**
+ * @brief Sets a color value for a field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to set.
+ * @return True if the field was successfully set, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbSetColorByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int value) {
+	return userMessage->SetColor(field, *reinterpret_cast<Color*>(&value));
+}
+
+/**
+ * @brief Sets a 2D vector for a field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to set.
+ * @return True if the field was successfully set, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbSetVector2ByField(UserMessage* userMessage, const pb::FieldDescriptor* field, const plg::vec2& value) {
+	return userMessage->SetVector2D(field, *reinterpret_cast<const Vector2D*>(&value));
+}
+
+/**
+ * @brief Sets a 3D vector for a field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to set.
+ * @return True if the field was successfully set, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbSetVector3ByField(UserMessage* userMessage, const pb::FieldDescriptor* field, const plg::vec3& value) {
+	return userMessage->SetVector(field, *reinterpret_cast<const Vector*>(&value));
+}
+
+/**
+ * @brief Sets a QAngle (rotation vector) for a field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to set.
+ * @return True if the field was successfully set, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbSetQAngleByField(UserMessage* userMessage, const pb::FieldDescriptor* field, const plg::vec3& value) {
+	return userMessage->SetQAngle(field, *reinterpret_cast<const QAngle*>(&value));
+}
+
+/**
+ * @brief Adds an enum value to a repeated field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to add.
+ * @return True if the value was successfully added, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbAddEnumByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int value) {
+	return userMessage->AddEnum(field, value);
+}
+
+/**
+ * @brief Adds a 32-bit integer to a repeated field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to add.
+ * @return True if the value was successfully added, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbAddInt32ByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int32_t value) {
+	return userMessage->AddInt32(field, value);
+}
+
+/**
+ * @brief Adds a 64-bit integer to a repeated field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to add.
+ * @return True if the value was successfully added, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbAddInt64ByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int64_t value) {
+	return userMessage->AddInt64(field, value);
+}
+
+/**
+ * @brief Adds an unsigned 32-bit integer to a repeated field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to add.
+ * @return True if the value was successfully added, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbAddUInt32ByField(UserMessage* userMessage, const pb::FieldDescriptor* field, uint32_t value) {
+	return userMessage->AddUInt32(field, value);
+}
+
+/**
+ * @brief Adds an unsigned 64-bit integer to a repeated field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to add.
+ * @return True if the value was successfully added, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbAddUInt64ByField(UserMessage* userMessage, const pb::FieldDescriptor* field, uint64_t value) {
+	return userMessage->AddUInt64(field, value);
+}
+
+/**
+ * @brief Adds a floating-point value to a repeated field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to add.
+ * @return True if the value was successfully added, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbAddFloatByField(UserMessage* userMessage, const pb::FieldDescriptor* field, float value) {
+	return userMessage->AddFloat(field, value);
+}
+
+/**
+ * @brief Adds a double-precision floating-point value to a repeated field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to add.
+ * @return True if the value was successfully added, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbAddDoubleByField(UserMessage* userMessage, const pb::FieldDescriptor* field, double value) {
+	return userMessage->AddDouble(field, value);
+}
+
+/**
+ * @brief Adds a boolean value to a repeated field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to add.
+ * @return True if the value was successfully added, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbAddBoolByField(UserMessage* userMessage, const pb::FieldDescriptor* field, bool value) {
+	return userMessage->AddBool(field, value);
+}
+
+/**
+ * @brief Adds a string to a repeated field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to add.
+ * @return True if the value was successfully added, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbAddStringByField(UserMessage* userMessage, const pb::FieldDescriptor* field, const plg::string& value) {
+	return userMessage->AddString(field, value.c_str());
+}
+
+/**
+ * @brief Adds a color value to a repeated field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to add.
+ * @return True if the value was successfully added, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbAddColorByField(UserMessage* userMessage, const pb::FieldDescriptor* field, int value) {
+	return userMessage->AddColor(field, *reinterpret_cast<Color*>(&value));
+}
+
+/**
+ * @brief Adds a 2D vector to a repeated field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to add.
+ * @return True if the value was successfully added, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbAddVector2ByField(UserMessage* userMessage, const pb::FieldDescriptor* field, const plg::vec2& value) {
+	return userMessage->AddVector2D(field, *reinterpret_cast<const Vector2D*>(&value));
+}
+
+/**
+ * @brief Adds a 3D vector to a repeated field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to add.
+ * @return True if the value was successfully added, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbAddVector3ByField(UserMessage* userMessage, const pb::FieldDescriptor* field, const plg::vec3& value) {
+	return userMessage->AddVector(field, *reinterpret_cast<const Vector*>(&value));
+}
+
+/**
+ * @brief Adds a QAngle (rotation vector) to a repeated field in the UserMessage by field handle.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param field Field handle returned by PbFindField.
+ * @param value The value to add.
+ * @return True if the value was successfully added, false otherwise.
+ */
+extern "C" PLUGIN_API bool PbAddQAngleByField(UserMessage* userMessage, const pb::FieldDescriptor* field, const plg::vec3& value) {
+	return userMessage->AddQAngle(field, *reinterpret_cast<const QAngle*>(&value));
+}
+
 PLUGIFY_WARN_POP()
\ No newline at end of file
@@ -0,0 +1,182 @@
+#include "mock_game_events.hpp"
+
+template<typename T>
+T MockGameEvent::Get(const GameEventKeySymbol_t& keySymbol, T defaultValue) const {
+	auto it = m_values.find(keySymbol.GetHashCode());
+	if (it == m_values.end()) {
+		return defaultValue;
+	}
+
+	return std::visit([&](const auto& value) -> T {
+		using V = std::decay_t<decltype(value)>;
+		if constexpr (std::is_same_v<V, T>) {
+			return value;
+		} else if constexpr (std::is_arithmetic_v<V> && std::is_arithmetic_v<T>) {
+			return static_cast<T>(value);
+		} else {
+			return defaultValue;
+		}
+	}, it->second);
+}
+
+bool MockGameEvent::IsEmpty(const GameEventKeySymbol_t& keySymbol) {
+	return !HasKey(keySymbol);
+}
+
+bool MockGameEvent::GetBool(const GameEventKeySymbol_t& keySymbol, bool defaultValue) {
+	return Get(keySymbol, defaultValue);
+}
+
+int MockGameEvent::GetInt(const GameEventKeySymbol_t& keySymbol, int defaultValue) {
+	return Get(keySymbol, defaultValue);
+}
+
+uint64 MockGameEvent::GetUint64(const GameEventKeySymbol_t& keySymbol, uint64 defaultValue) {
+	return Get(keySymbol, defaultValue);
+}
+
+float MockGameEvent::GetFloat(const GameEventKeySymbol_t& keySymbol, float defaultValue) {
+	return Get(keySymbol, defaultValue);
+}
+
+const char* MockGameEvent::GetString(const GameEventKeySymbol_t& keySymbol, const char* defaultValue) {
+	auto it = m_values.find(keySymbol.GetHashCode());
+	if (it == m_values.end()) {
+		return defaultValue;
+	}
+
+	const auto* value = std::get_if<std::string>(&it->second);
+	return value ? value->c_str() : defaultValue;
+}
+
+void* MockGameEvent::GetPtr(const GameEventKeySymbol_t& keySymbol) {
+	return Get<void*>(keySymbol, nullptr);
+}
+
+CEntityHandle MockGameEvent::GetEHandle(const GameEventKeySymbol_t& keySymbol, CEntityHandle defaultValue) {
+	return CEntityHandle(static_cast<uint32>(Get(keySymbol, static_cast<int>(defaultValue.ToInt()))));
+}
+
+// There are no entities without a game, entity fields only hold their index or handle
+CEntityInstance* MockGameEvent::GetEntity(const GameEventKeySymbol_t& keySymbol, CEntityInstance* fallbackInstance) {
+	return fallbackInstance;
+}
+
+CEntityIndex MockGameEvent::GetEntityIndex(const GameEventKeySymbol_t& keySymbol, CEntityIndex defaultValue) {
+	return CEntityIndex(Get(keySymbol, defaultValue.Get()));
+}
+
+CPlayerSlot MockGameEvent::GetPlayerSlot(const GameEventKeySymbol_t& keySymbol) {
+	return CPlayerSlot(Get(keySymbol, -1));
+}
+
+CEntityInstance* MockGameEvent::GetPlayerController(const GameEventKeySymbol_t& keySymbol) {
+	return nullptr;
+}
+
+CEntityInstance* MockGameEvent::GetPlayerPawn(const GameEventKeySymbol_t& keySymbol) {
+	return nullptr;
+}
+
+CEntityHandle MockGameEvent::GetPawnEHandle(const GameEventKeySymbol_t& keySymbol) {
+	return CEntityHandle();
+}
+
+CEntityIndex MockGameEvent::GetPawnEntityIndex(const GameEventKeySymbol_t& keySymbol) {
+	return CEntityIndex(-1);
+}
+
+void MockGameEvent::SetBool(const GameEventKeySymbol_t& keySymbol, bool value) {
+	m_values[keySymbol.GetHashCode()] = value;
+}
+
+void MockGameEvent::SetInt(const GameEventKeySymbol_t& keySymbol, int value) {
+	m_values[keySymbol.GetHashCode()] = value;
+}
+
+void MockGameEvent::SetUint64(const GameEventKeySymbol_t& keySymbol, uint64 value) {
+	m_values[keySymbol.GetHashCode()] = value;
+}
+
+void MockGameEvent::SetFloat(const GameEventKeySymbol_t& keySymbol, float value) {
+	m_values[keySymbol.GetHashCode()] = value;
+}
+
+void MockGameEvent::SetString(const GameEventKeySymbol_t& keySymbol, const char* value) {
+	m_values[keySymbol.GetHashCode()] = std::string(value ? value : "");
+}
+
+void MockGameEvent::SetPtr(const GameEventKeySymbol_t& keySymbol, void* value) {
+	m_values[keySymbol.GetHashCode()] = value;
+}
+
+void MockGameEvent::SetEntity(const GameEventKeySymbol_t& keySymbol, CEntityInstance* value) {
+	m_values[keySymbol.GetHashCode()] = static_cast<void*>(value);
+}
+
+void MockGameEvent::SetEntity(const GameEventKeySymbol_t& keySymbol, CEntityIndex value) {
+	m_values[keySymbol.GetHashCode()] = value.Get();
+}
+
+void MockGameEvent::SetPlayer(const GameEventKeySymbol_t& keySymbol, CEntityInstance* pawn) {
+	m_values[keySymbol.GetHashCode()] = static_cast<void*>(pawn);
+}
+
+void MockGameEvent::SetPlayer(const GameEventKeySymbol_t& keySymbol, CPlayerSlot value) {
+	m_values[keySymbol.GetHashCode()] = value.Get();
+}
+
+void MockGameEvent::SetPlayerRaw(const GameEventKeySymbol_t& controllerKeySymbol, const GameEventKeySymbol_t& pawnKeySymbol, CEntityInstance* pawn) {
+	m_values[controllerKeySymbol.GetHashCode()] = static_cast<void*>(pawn);
+	m_values[pawnKeySymbol.GetHashCode()] = static_cast<void*>(pawn);
+}
+
+bool MockGameEvent::HasKey(const GameEventKeySymbol_t& keySymbol) {
+	return m_values.contains(keySymbol.GetHashCode());
+}
+
+bool MockGameEventManager::AddListener(IGameEventListener2* listener, const char* name, bool serverSide) {
+	if (FindListener(listener, name)) {
+		return false;
+	}
+
+	m_listeners.emplace(listener, name);
+	return true;
+}
+
+bool MockGameEventManager::FindListener(IGameEventListener2* listener, const char* name) {
+	auto [begin, end] = m_listeners.equal_range(listener);
+	return std::any_of(begin, end, [&](const auto& pair) { return pair.second == name; });
+}
+
+void MockGameEventManager::RemoveListener(IGameEventListener2* listener) {
+	m_listeners.erase(listener);
+}
+
+IGameEvent* MockGameEventManager::CreateEvent(const char* name, bool force, int* cookie) {
+	return new MockGameEvent(name, LookupEventId(name));
+}
+
+// Nobody is connected, firing only frees the event as the engine does
+bool MockGameEventManager::FireEvent(IGameEvent* event, bool dontBroadcast) {
+	FreeEvent(event);
+	return true;
+}
+
+bool MockGameEventManager::FireEventClientSide(IGameEvent* event) {
+	FreeEvent(event);
+	return true;
+}
+
+IGameEvent* MockGameEventManager::DuplicateEvent(IGameEvent* event) {
+	return new MockGameEvent(*static_cast<MockGameEvent*>(event));
+}
+
+void MockGameEventManager::FreeEvent(IGameEvent* event) {
+	delete static_cast<MockGameEvent*>(event);
+}
+
+int MockGameEventManager::LookupEventId(const char* name) {
+	auto [it, _] = m_ids.try_emplace(name, static_cast<int>(m_ids.size()));
+	return it->second;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <igameevents.h>
+#include <variant>
+
+// Stand-in for the engine game event system, so recordings can be replayed through the plugin hooks
+// without a running game. Events keep their fields in a map by key hash, every name is a known event
+// and gets an id the first time it is seen. Listeners are accepted but never called.
+class MockGameEvent final : public IGameEvent {
+public:
+	MockGameEvent(const char* name, int id) : m_name(name), m_id(id) {}
+
+	const char* GetName() const override { return m_name.c_str(); }
+	int GetID() const override { return m_id; }
+
+	bool IsReliable() const override { return true; }
+	bool IsLocal() const override { return false; }
+	bool IsEmpty(const GameEventKeySymbol_t& keySymbol) override;
+
+	bool GetBool(const GameEventKeySymbol_t& keySymbol, bool defaultValue) override;
+	int GetInt(const GameEventKeySymbol_t& keySymbol, int defaultValue) override;
+	uint64 GetUint64(const GameEventKeySymbol_t& keySymbol, uint64 defaultValue) override;
+	float GetFloat(const GameEventKeySymbol_t& keySymbol, float defaultValue) override;
+	const char* GetString(const GameEventKeySymbol_t& keySymbol, const char* defaultValue) override;
+	void* GetPtr(const GameEventKeySymbol_t& keySymbol) override;
+
+	CEntityHandle GetEHandle(const GameEventKeySymbol_t& keySymbol, CEntityHandle defaultValue) override;
+	CEntityInstance* GetEntity(const GameEventKeySymbol_t& keySymbol, CEntityInstance* fallbackInstance) override;
+	CEntityIndex GetEntityIndex(const GameEventKeySymbol_t& keySymbol, CEntityIndex defaultValue) override;
+	CPlayerSlot GetPlayerSlot(const GameEventKeySymbol_t& keySymbol) override;
+	CEntityInstance* GetPlayerController(const GameEventKeySymbol_t& keySymbol) override;
+	CEntityInstance* GetPlayerPawn(const GameEventKeySymbol_t& keySymbol) override;
+	CEntityHandle GetPawnEHandle(const GameEventKeySymbol_t& keySymbol) override;
+	CEntityIndex GetPawnEntityIndex(const GameEventKeySymbol_t& keySymbol) override;
+
+	void SetBool(const GameEventKeySymbol_t& keySymbol, bool value) override;
+	void SetInt(const GameEventKeySymbol_t& keySymbol, int value) override;
+	void SetUint64(const GameEventKeySymbol_t& keySymbol, uint64 value) override;
+	void SetFloat(const GameEventKeySymbol_t& keySymbol, float value) override;
+	void SetString(const GameEventKeySymbol_t& keySymbol, const char* value) override;
+	void SetPtr(const GameEventKeySymbol_t& keySymbol, void* value) override;
+
+	void SetEntity(const GameEventKeySymbol_t& keySymbol, CEntityInstance* value) override;
+	void SetEntity(const GameEventKeySymbol_t& keySymbol, CEntityIndex value) override;
+	void SetPlayer(const GameEventKeySymbol_t& keySymbol, CEntityInstance* pawn) override;
+	void SetPlayer(const GameEventKeySymbol_t& keySymbol, CPlayerSlot value) override;
+	void SetPlayerRaw(const GameEventKeySymbol_t& controllerKeySymbol, const GameEventKeySymbol_t& pawnKeySymbol, CEntityInstance* pawn) override;
+
+	bool HasKey(const GameEventKeySymbol_t& keySymbol) override;
+
+	void unk001() override {}
+
+private:
+	using Value = std::variant<bool, int, uint64, float, std::string, void*>;
+
+	template<typename T>
+	T Get(const GameEventKeySymbol_t& keySymbol, T defaultValue) const;
+
+private:
+	std::string m_name;
+	int m_id;
+	std::unordered_map<uint32, Value> m_values;
+};
+
+class MockGameEventManager final : public IGameEventManager2 {
+public:
+	int LoadEventsFromFile(const char* filename, bool searchAll) override { return 0; }
+	void Reset() override { m_ids.clear(); }
+
+	bool AddListener(IGameEventListener2* listener, const char* name, bool serverSide) override;
+	bool FindListener(IGameEventListener2* listener, const char* name) override;
+	void RemoveListener(IGameEventListener2* listener) override;
+
+	IGameEvent* CreateEvent(const char* name, bool force, int* cookie) override;
+	bool FireEvent(IGameEvent* event, bool dontBroadcast) override;
+	bool FireEventClientSide(IGameEvent* event) override;
+	IGameEvent* DuplicateEvent(IGameEvent* event) override;
+	void FreeEvent(IGameEvent* event) override;
+
+	bool SerializeEvent(IGameEvent* event, CMsgSource1LegacyGameEvent* ev) override { return false; }
+	IGameEvent* UnserializeEvent(const CMsgSource1LegacyGameEvent& ev) override { return nullptr; }
+
+	int LookupEventId(const char* name) override;
+	void PrintEventToString(IGameEvent* event, CUtlString& out) override {}
+	bool HasEventDescriptor(const char* name) override { return true; }
+
+private:
+	void unk001(void*) override {}
+
+private:
+	std::unordered_map<std::string, int> m_ids;
+	std::unordered_multimap<IGameEventListener2*, std::string> m_listeners;
+};
@@ -0,0 +1,451 @@
+#!/usr/bin/env python3
+# plugify-source2
+# Copyright (C) 2023-2025 untrustedmodders
+# Licensed under the GPLv3 license. See LICENSE file in the project root for details.
+
+"""Generates typed user message accessors from the game .proto files.
+
+Reads the message definitions the SDK compiles into its *.pb.h headers and emits
+src/export/user_message_accessors.cpp, a getter and setter export per field of the
+selected messages. The exports cast the UserMessage to the generated protobuf class
+and call its field accessors directly, without reflection or a name lookup.
+
+The plugin manifest and the symbol lists are updated to match, entries of fields
+that no longer exist are removed.
+
+Usage: generate_user_messages.py --proto <file.proto> [--proto ...] [--message <Name> ...] [--check]
+
+Configuring the project regenerates the files whenever the SDK is present. With
+--check nothing is written, the script fails if the committed files differ from
+what the .proto files produce, CI runs it on every push.
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+DEFAULT_MESSAGES = [
+	'CUserMessageTextMsg',
+	'CUserMessageSayText2',
+	'CUserMessageShake',
+	'CUserMessageFade',
+]
+
+MESSAGE_PREFIXES = ['CUserMessage', 'CCSUsrMsg_', 'CNETMsg_', 'CSVCMsg_']
+
+# proto type: (c++ type, manifest type, default value)
+SCALAR_TYPES = {
+	'int32': ('int32_t', 'int32', '0'),
+	'sint32': ('int32_t', 'int32', '0'),
+	'sfixed32': ('int32_t', 'int32', '0'),
+	'uint32': ('uint32_t', 'uint32', '0'),
+	'fixed32': ('uint32_t', 'uint32', '0'),
+	'int64': ('int64_t', 'int64', '0'),
+	'sint64': ('int64_t', 'int64', '0'),
+	'sfixed64': ('int64_t', 'int64', '0'),
+	'uint64': ('uint64_t', 'uint64', '0'),
+	'fixed64': ('uint64_t', 'uint64', '0'),
+	'float': ('float', 'float', '0.0f'),
+	'double': ('double', 'double', '0.0'),
+	'bool': ('bool', 'bool', 'false'),
+	'string': ('plg::string', 'string', '{}'),
+	'bytes': ('plg::string', 'string', '{}'),
+}
+
+OUTPUT = os.path.join(ROOT, 'src', 'export', 'user_message_accessors.cpp')
+MANIFEST = os.path.join(ROOT, 'plugify-plugin-s2sdk.pplugin.in')
+EXPORTED_SYMBOLS = os.path.join(ROOT, 'sym', 'exported_symbols.lds')
+VERSION_SCRIPT = os.path.join(ROOT, 'sym', 'version_script.lds')
+MANIFEST_ANCHOR = 'PbAddQAngleByField'
+
+
+class Field:
+	def __init__(self, label, type, name):
+		self.label = label
+		self.type = type
+		self.name = name
+		# C++ name of the enum type, None for other types
+		self.enum = None
+
+
+class Message:
+	def __init__(self, name, header, body):
+		self.name = name
+		self.header = header
+		self.body = body
+		self.fields = []
+
+
+def strip_comments(text):
+	text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+	return re.sub(r'//[^\n]*', '', text)
+
+
+def parse_block(text, start):
+	"""Returns the body of the braced block that opens at text[start] and the index past it."""
+	depth = 0
+	for i in range(start, len(text)):
+		if text[i] == '{':
+			depth += 1
+		elif text[i] == '}':
+			depth -= 1
+			if depth == 0:
+				return text[start + 1:i], i + 1
+	raise ValueError('unbalanced braces')
+
+
+def remove_nested_blocks(body):
+	out = []
+	i = 0
+	while i < len(body):
+		match = re.compile(r'\b(message|enum|oneof)\s+\w+\s*\{').search(body, i)
+		if not match:
+			out.append(body[i:])
+			break
+		out.append(body[i:match.start()])
+		_, i = parse_block(body, match.end() - 1)
+	return ''.join(out)
+
+
+def parse_declarations(body, scope, header, package, enums, messages):
+	"""Collects the enums (with their package) and messages declared in body, nested ones by their dotted name."""
+	i = 0
+	while True:
+		match = re.compile(r'\b(message|enum)\s+(\w+)\s*\{').search(body, i)
+		if not match:
+			break
+		inner, i = parse_block(body, match.end() - 1)
+		name = scope + match.group(2)
+		if match.group(1) == 'enum':
+			enums[name] = package
+		else:
+			messages[name] = Message(name, header, inner)
+			parse_declarations(inner, name + '.', header, package, enums, messages)
+
+
+def parse_proto(path, enums, messages, packages):
+	text = strip_comments(open(path, encoding='utf-8').read())
+	header = os.path.splitext(os.path.basename(path))[0] + '.pb.h'
+
+	match = re.search(r'^package\s+([\w.]+)\s*;', text, flags=re.M)
+	package = match.group(1) if match else ''
+	if package:
+		packages.add(package)
+
+	parse_declarations(text, '', header, package, enums, messages)
+
+
+def resolve_enum(type, scope, enums, packages):
+	"""Returns the dotted name of the enum a field type refers to, or None if it is not an enum."""
+	qualified = type.startswith('.')
+	type = type.lstrip('.')
+	for package in packages:
+		if type.startswith(package + '.'):
+			type = type[len(package) + 1:]
+			qualified = True
+			break
+
+	if qualified:
+		return type if type in enums else None
+
+	# Relative names are looked up from the innermost scope out, as protoc does
+	parts = scope.split('.')
+	for n in range(len(parts), -1, -1):
+		candidate = '.'.join(parts[:n] + [type])
+		if candidate in enums:
+			return candidate
+	return None
+
+
+def parse_fields(message, enums, packages):
+	for label, type, name in re.findall(r'\b(optional|required|repeated)\s+([\w.]+)\s+(\w+)\s*=\s*\d+', remove_nested_blocks(message.body)):
+		field = Field(label, type, name)
+		enum = resolve_enum(type, message.name, enums, packages)
+		if enum:
+			# Nested enums are named Outer_Inner in C++, packages become namespaces
+			namespace = enums[enum].replace('.', '::') + '::' if enums[enum] else ''
+			field.enum = namespace + enum.replace('.', '_')
+		message.fields.append(field)
+
+
+def short_name(message):
+	for prefix in MESSAGE_PREFIXES:
+		if message.startswith(prefix):
+			return message[len(prefix):]
+	return message
+
+
+def camel_case(name):
+	return ''.join(part[:1].upper() + part[1:] for part in name.split('_'))
+
+
+def field_types(field):
+	if field.enum:
+		return 'int', 'int32', '0'
+	return SCALAR_TYPES.get(field.type)
+
+
+def param_type(cpp_type):
+	return 'const plg::string&' if cpp_type == 'plg::string' else cpp_type
+
+
+def set_value(field, cpp_type):
+	if field.enum:
+		return f'static_cast<{field.enum}>(value)'
+	if cpp_type == 'plg::string':
+		return 'std::string(value)'
+	return 'value'
+
+
+def method(name, description, params, ret_type, ret_description):
+	return {
+		'name': name,
+		'group': 'Protobuf',
+		'description': description,
+		'funcName': name,
+		'paramTypes': params,
+		'retType': {'type': ret_type, 'description': ret_description},
+	}
+
+
+USER_MESSAGE_PARAM = {'name': 'userMessage', 'type': 'ptr64', 'ref': False, 'description': 'The UserMessage instance.'}
+
+
+def generate_field(message, field, exports, methods):
+	types = field_types(field)
+	if not types:
+		print(f'{message.name}.{field.name} has unsupported type "{field.type}", skipping', file=sys.stderr)
+		return
+	cpp_type, manifest_type, default = types
+	short = short_name(message.name)
+	prefix = f'Pb{short}'
+	camel = camel_case(field.name)
+	valid = f'\tif (!{field.enum}_IsValid(value)) return false;\n' if field.enum else ''
+
+	if field.label != 'repeated':
+		getter = f'{prefix}Get{camel}'
+		exports.append(f'''/**
+ * @brief Gets the {field.name} field of a {short} message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return The field value, or a default value if the message is not a {short} message.
+ */
+extern "C" PLUGIN_API {cpp_type} {getter}(UserMessage* userMessage) {{
+	auto* msg = userMessage->As<{message.name}>();
+	if (!msg) return {default};
+	return msg->{field.name.lower()}();
+}}
+''')
+		methods.append(method(getter, f'Gets the {field.name} field of a {short} message.', [USER_MESSAGE_PARAM], manifest_type,
+							  f'The field value, or a default value if the message is not a {short} message.'))
+
+		setter = f'{prefix}Set{camel}'
+		exports.append(f'''/**
+ * @brief Sets the {field.name} field of a {short} message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param value The value to set.
+ * @return True if the field was set, false if the message is not a {short} message.
+ */
+extern "C" PLUGIN_API bool {setter}(UserMessage* userMessage, {param_type(cpp_type)} value) {{
+	auto* msg = userMessage->As<{message.name}>();
+	if (!msg) return false;
+{valid}	msg->set_{field.name.lower()}({set_value(field, cpp_type)});
+	return true;
+}}
+''')
+		methods.append(method(setter, f'Sets the {field.name} field of a {short} message.',
+							  [USER_MESSAGE_PARAM, {'name': 'value', 'type': manifest_type, 'ref': False, 'description': 'The value to set.'}],
+							  'bool', f'True if the field was set, false if the message is not a {short} message.'))
+		return
+
+	getter = f'{prefix}Get{camel}'
+	exports.append(f'''/**
+ * @brief Gets an element of the repeated {field.name} field of a {short} message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param index The index of the element.
+ * @return The element value, or a default value if the index or the message type is invalid.
+ */
+extern "C" PLUGIN_API {cpp_type} {getter}(UserMessage* userMessage, int index) {{
+	auto* msg = userMessage->As<{message.name}>();
+	if (!msg || index < 0 || index >= msg->{field.name.lower()}_size()) return {default};
+	return msg->{field.name.lower()}(index);
+}}
+''')
+	methods.append(method(getter, f'Gets an element of the repeated {field.name} field of a {short} message.',
+						  [USER_MESSAGE_PARAM, {'name': 'index', 'type': 'int32', 'ref': False, 'description': 'The index of the element.'}],
+						  manifest_type, 'The element value, or a default value if the index or the message type is invalid.'))
+
+	counter = f'{prefix}Get{camel}Count'
+	exports.append(f'''/**
+ * @brief Gets the number of elements in the repeated {field.name} field of a {short} message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @return The number of elements, or -1 if the message is not a {short} message.
+ */
+extern "C" PLUGIN_API int {counter}(UserMessage* userMessage) {{
+	auto* msg = userMessage->As<{message.name}>();
+	return msg ? msg->{field.name.lower()}_size() : -1;
+}}
+''')
+	methods.append(method(counter, f'Gets the number of elements in the repeated {field.name} field of a {short} message.', [USER_MESSAGE_PARAM],
+						  'int32', f'The number of elements, or -1 if the message is not a {short} message.'))
+
+	adder = f'{prefix}Add{camel}'
+	exports.append(f'''/**
+ * @brief Adds an element to the repeated {field.name} field of a {short} message.
+ *
+ * @param userMessage The UserMessage instance.
+ * @param value The value to add.
+ * @return True if the element was added, false if the message is not a {short} message.
+ */
+extern "C" PLUGIN_API bool {adder}(UserMessage* userMessage, {param_type(cpp_type)} value) {{
+	auto* msg = userMessage->As<{message.name}>();
+	if (!msg) return false;
+{valid}	msg->add_{field.name.lower()}({set_value(field, cpp_type)});
+	return true;
+}}
+''')
+	methods.append(method(adder, f'Adds an element to the repeated {field.name} field of a {short} message.',
+						  [USER_MESSAGE_PARAM, {'name': 'value', 'type': manifest_type, 'ref': False, 'description': 'The value to add.'}],
+						  'bool', f'True if the element was added, false if the message is not a {short} message.'))
+
+
+def read_file(path):
+	with open(path, encoding='utf-8', newline='') as file:
+		return file.read()
+
+
+def read_generated_names():
+	if not os.path.exists(OUTPUT):
+		return []
+	return re.findall(r'PLUGIN_API [\w:&<> ]+? (\w+)\(', read_file(OUTPUT))
+
+
+def find_method_block(lines, name):
+	try:
+		idx = lines.index(f'      "name": "{name}",')
+	except ValueError:
+		return None
+	start = idx - 1
+	end = next(i for i in range(idx, len(lines)) if lines[i] in ('    },', '    }'))
+	return start, end
+
+
+def update_manifest(old_names, methods):
+	lines = read_file(MANIFEST).split('\n')
+
+	for name in old_names:
+		block = find_method_block(lines, name)
+		if not block:
+			continue
+		start, end = block
+		if lines[end] == '    }':
+			# Last entry, the comma moves to the previous one
+			lines[start - 1] = '    }'
+		del lines[start:end + 1]
+
+	_, end = find_method_block(lines, MANIFEST_ANCHOR)
+	text = ',\n'.join('\n'.join('    ' + l for l in json.dumps(m, indent=2, ensure_ascii=False).split('\n')) for m in methods)
+	if lines[end] == '    },':
+		lines[end + 1:end + 1] = (text + ',').split('\n')
+	else:
+		lines[end] = '    },'
+		lines[end + 1:end + 1] = text.split('\n')
+
+	output = '\n'.join(lines)
+	json.loads(output)
+	return output
+
+
+def update_symbols(path, fmt, old_names, names):
+	lines = read_file(path).split('\n')
+	old = {fmt.format(name) for name in old_names}
+	lines = [l for l in lines if l not in old]
+	idx = lines.index(fmt.format(MANIFEST_ANCHOR))
+	lines[idx + 1:idx + 1] = [fmt.format(name) for name in names]
+	return '\n'.join(lines)
+
+
+def main():
+	parser = argparse.ArgumentParser(description='Generates typed user message accessors from .proto files.')
+	parser.add_argument('--proto', action='append', required=True, help='A .proto file with the message definitions.')
+	parser.add_argument('--message', action='append', help='A message to generate accessors for, defaults to the common chat and screen messages.')
+	parser.add_argument('--check', action='store_true', help='Compare the committed output with the .proto files instead of writing it, exits with 1 if it is stale.')
+	args = parser.parse_args()
+
+	enums = {}
+	messages = {}
+	packages = set()
+	for path in args.proto:
+		parse_proto(path, enums, messages, packages)
+
+	selected = []
+	for name in args.message or DEFAULT_MESSAGES:
+		if name not in messages:
+			print(f'Message "{name}" was not found, skipping', file=sys.stderr)
+			continue
+		parse_fields(messages[name], enums, packages)
+		selected.append(messages[name])
+
+	exports = []
+	methods = []
+	for message in selected:
+		for field in message.fields:
+			generate_field(message, field, exports, methods)
+
+	headers = sorted({message.header for message in selected})
+	includes = '\n'.join(f'#include <{header}>' for header in headers)
+
+	old_names = read_generated_names()
+
+	outputs = {}
+	outputs[OUTPUT] = f'''// Generated by tools/generate_user_messages.py, do not edit.
+
+#include <core/user_message.hpp>
+{includes}
+#include <plugin_export.h>
+
+PLUGIFY_WARN_PUSH()
+
+#if defined(__clang)
+PLUGIFY_WARN_IGNORE("-Wreturn-type-c-linkage")
+#elif defined(_MSC_VER)
+PLUGIFY_WARN_IGNORE(4190)
+#endif
+
+{chr(10).join(exports)}
+PLUGIFY_WARN_POP()
+'''
+
+	names = [m['name'] for m in methods]
+	outputs[MANIFEST] = update_manifest(old_names, methods)
+	outputs[EXPORTED_SYMBOLS] = update_symbols(EXPORTED_SYMBOLS, '{}', old_names, names)
+	outputs[VERSION_SCRIPT] = update_symbols(VERSION_SCRIPT, '        {};', old_names, names)
+
+	if args.check:
+		stale = [path for path, text in outputs.items() if not os.path.exists(path) or read_file(path) != text]
+		for path in stale:
+			print(f'{os.path.relpath(path, ROOT)} does not match the .proto files, run generate_user_messages.py', file=sys.stderr)
+		if stale:
+			sys.exit(1)
+		print(f'{len(names)} accessors for {len(selected)} messages are up to date')
+		return
+
+	for path, text in outputs.items():
+		# Unchanged files keep their timestamp, so regenerating on every configure does not force a rebuild
+		if os.path.exists(path) and read_file(path) == text:
+			continue
+		with open(path, 'w', encoding='utf-8', newline='\n') as file:
+			file.write(text)
+
+	print(f'Generated {len(names)} accessors for {len(selected)} messages')
+
+
+if __name__ == '__main__':
+	main()